@@ -10,10 +10,15 @@
 #include "fsl_debug_console.h"
 #include "pin_mux.h"
 #include "board.h"
+#include "fsl_port.h"
+#include "state_trace.h"
 
 /*******************************************************************************
  * Variables
  ******************************************************************************/
+#if (defined(BOARD_STATE_TRACE_ENABLE) && (BOARD_STATE_TRACE_ENABLE > 0U))
+uint32_t g_boardStateTraceCode = (uint32_t)kSTATE_TRACE_Active;
+#endif
 
 /*******************************************************************************
  * Code
@@ -31,3 +36,33 @@ void BOARD_InitDebugConsole(void)
     DbgConsole_Init(BOARD_DEBUG_UART_INSTANCE, BOARD_DEBUG_UART_BAUDRATE, BOARD_DEBUG_UART_TYPE,
                     BOARD_DEBUG_UART_CLK_FREQ);
 }
+
+/* Initialize the state trace bus. */
+void BOARD_InitStateTrace(void)
+{
+#if (defined(BOARD_STATE_TRACE_ENABLE) && (BOARD_STATE_TRACE_ENABLE > 0U))
+    gpio_pin_config_t traceConfig = {kGPIO_DigitalOutput, 0U};
+    uint32_t pin;
+
+    /* Held for good, the bus is driven in low power modes too. */
+    CLOCK_RequestClock(BOARD_STATE_TRACE_PORT_CLOCK);
+    CLOCK_RequestClock(BOARD_STATE_TRACE_GPIO_CLOCK);
+
+    for (pin = BOARD_STATE_TRACE_FIRST_PIN; pin < (BOARD_STATE_TRACE_FIRST_PIN + BOARD_STATE_TRACE_WIDTH); pin++)
+    {
+        /* Alt0 is the GPIO function. */
+        PORT_SetPinMux(BOARD_STATE_TRACE_PORT, pin, kPORT_MuxAlt0);
+        GPIO_PinInit(BOARD_STATE_TRACE_GPIO, pin, &traceConfig);
+    }
+
+    g_boardStateTraceCode = (uint32_t)kSTATE_TRACE_Active;
+#endif
+}
+
+#if (defined(BOARD_STATE_TRACE_ENABLE) && (BOARD_STATE_TRACE_ENABLE > 0U))
+/* Drives the driver states on the trace bus, overrides the weak default in fsl_common. */
+uint32_t SDK_TraceState(uint32_t state)
+{
+    return BOARD_StateTraceSet(state);
+}
+#endif
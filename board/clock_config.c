@@ -35,6 +35,7 @@ processor_version: 0.13.0
 
 #include "fsl_clock.h"
 #include "clock_config.h"
+#include "state_trace.h"
 
 
 /*******************************************************************************
@@ -52,8 +53,9 @@ extern uint32_t SystemCoreClock;
  ******************************************************************************/
 void BOARD_InitBootClocks(void)
 {
-    BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength, 
-                          kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
+    /* On failure the core keeps the clock the boot ROM left, the clock driver reports it */
+    (void)BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength, 
+                                kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
 }
 
 /*******************************************************************************
@@ -85,33 +87,46 @@ settings:
 /*******************************************************************************
  * Code for BOARD_BootClockFRO12M configuration
  ******************************************************************************/
-void BOARD_BootClockFRO12M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_core_ldo_drive_strength_t active_ldo_strength, spc_core_ldo_voltage_level_t lowpower_ldo_voltage, spc_core_ldo_drive_strength_t lowpower_ldo_strength)
+status_t BOARD_BootClockFRO12M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_core_ldo_drive_strength_t active_ldo_strength, spc_core_ldo_voltage_level_t lowpower_ldo_voltage, spc_core_ldo_drive_strength_t lowpower_ldo_strength)
 {
     uint32_t coreFreq;
+    status_t status = kStatus_Success;
+    uint32_t traceState = BOARD_StateTraceSet((uint32_t)kSTATE_TRACE_ClockSwitch);
     spc_active_mode_core_ldo_option_t ldoOption;
     spc_lowpower_mode_core_ldo_option_t lowpower_ldoOption;
-    spc_sram_voltage_config_t sramOption;
+    spc_regulator_transaction_t regulators;
 
     /* Get the CPU Core frequency */
     coreFreq = CLOCK_GetCoreSysClkFreq();
 
+    /* Regulators of the target frequency: one ordered commit, with a single SPC busy wait. */
+    SPC_BeginRegulatorTransaction(&regulators);
+    ldoOption.CoreLDOVoltage = active_ldo_voltage;
+    ldoOption.CoreLDODriveStrength = active_ldo_strength;
+    SPC_StageActiveModeCoreLDORegulatorConfig(&regulators, &ldoOption);
+    lowpower_ldoOption.CoreLDOVoltage = lowpower_ldo_voltage;
+    lowpower_ldoOption.CoreLDODriveStrength = lowpower_ldo_strength;
+    SPC_StageLowPowerModeCoreLDORegulatorConfig(&regulators, &lowpower_ldoOption);
+    /* The bandgap is only kept in low power modes for a normal drive strength. */
+    SPC_StageLowPowerModeBandgapmodeConfig(&regulators, (lowpower_ldo_strength == kSPC_CoreLDO_NormalDriveStrength) ?
+                                                            kSPC_BandgapEnabledBufferDisabled : kSPC_BandgapDisabled);
+    if (lowpower_ldo_strength != kSPC_CoreLDO_NormalDriveStrength) {
+        /* The glitch detect must be disabled along with the bandgap. */
+        SPC_StageDisableLowPowerModeVddCoreGlitchDetect(&regulators, true);
+    }
+    /* Specifies the operating voltage for the SRAM's read/write timing margin */
+    SPC_StageSRAMOperateVoltage(&regulators, kSPC_sramOperateAt1P0V);
+
     /* The flow of increasing voltage and frequency */
     if (coreFreq <= BOARD_BOOTCLOCKFRO12M_CORE_CLOCK) {
-        /* Set the LDO_CORE VDD regulator level */
-        ldoOption.CoreLDOVoltage = active_ldo_voltage;
-        ldoOption.CoreLDODriveStrength = active_ldo_strength;
-        (void)SPC_SetActiveModeCoreLDORegulatorConfig(SPC0, &ldoOption);
-        SPC_SetLowPowerModeBandgapmodeConfig(SPC0, kSPC_BandgapEnabledBufferDisabled);
-        lowpower_ldoOption.CoreLDOVoltage = lowpower_ldo_voltage;
-        lowpower_ldoOption.CoreLDODriveStrength = lowpower_ldo_strength;
-        (void)SPC_SetLowPowerModeCoreLDORegulatorConfig(SPC0, &lowpower_ldoOption);
-        SPC_SetLowPowerModeBandgapmodeConfig(SPC0, kSPC_BandgapDisabled);
+        status = SPC_CommitRegulatorTransaction(SPC0, &regulators);
+        if (status != kStatus_Success) {
+            /* The regulators may not support the target frequency: keep the current clock and wait states */
+            (void)BOARD_StateTraceSet(traceState);
+            return status;
+        }
         /* Configure Flash to support different voltage level and frequency */
         FMU0->FCTRL = (FMU0->FCTRL & ~((uint32_t)FMU_FCTRL_RWSC_MASK)) | (FMU_FCTRL_RWSC(0x0U));
-        /* Specifies the operating voltage for the SRAM's read/write timing margin */
-        sramOption.operateVoltage = kSPC_sramOperateAt1P0V;
-        sramOption.requestVoltageUpdate =  true;
-        (void)SPC_SetSRAMOperateVoltage(SPC0, &sramOption);
     }
 
     CLOCK_SetupFRO12MClocking();                /*!< Setup FRO12M clock */
@@ -122,19 +137,8 @@ void BOARD_BootClockFRO12M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_
     if (coreFreq > BOARD_BOOTCLOCKFRO12M_CORE_CLOCK) {
         /* Configure Flash to support different voltage level and frequency */
         FMU0->FCTRL = (FMU0->FCTRL & ~((uint32_t)FMU_FCTRL_RWSC_MASK)) | (FMU_FCTRL_RWSC(0x0U));
-        /* Specifies the operating voltage for the SRAM's read/write timing margin */
-        sramOption.operateVoltage = kSPC_sramOperateAt1P0V;
-        sramOption.requestVoltageUpdate =  true;
-        (void)SPC_SetSRAMOperateVoltage(SPC0, &sramOption);
-         /* Set the LDO_CORE VDD regulator level */
-        ldoOption.CoreLDOVoltage = active_ldo_voltage;
-        ldoOption.CoreLDODriveStrength = active_ldo_strength;
-        (void)SPC_SetActiveModeCoreLDORegulatorConfig(SPC0, &ldoOption);
-        SPC_SetLowPowerModeBandgapmodeConfig(SPC0, kSPC_BandgapEnabledBufferDisabled);
-        lowpower_ldoOption.CoreLDOVoltage = lowpower_ldo_voltage;
-        lowpower_ldoOption.CoreLDODriveStrength = lowpower_ldo_strength;
-        (void)SPC_SetLowPowerModeCoreLDORegulatorConfig(SPC0, &lowpower_ldoOption);
-        SPC_SetLowPowerModeBandgapmodeConfig(SPC0, kSPC_BandgapDisabled);
+        /* The clock is already lower: a failed commit leaves the regulators at their previous, higher level */
+        status = SPC_CommitRegulatorTransaction(SPC0, &regulators);
     }
 
     /*!< Set up clock selectors - Attach clocks to the peripheries */
@@ -144,6 +148,10 @@ void BOARD_BootClockFRO12M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_
 
     /* Set SystemCoreClock variable */
     SystemCoreClock = BOARD_BOOTCLOCKFRO12M_CORE_CLOCK;
+
+    (void)BOARD_StateTraceSet(traceState);
+
+    return status;
 }
 /*******************************************************************************
  ******************** Configuration BOARD_BootClockFRO24M **********************
@@ -174,27 +182,35 @@ settings:
 /*******************************************************************************
  * Code for BOARD_BootClockFRO24M configuration
  ******************************************************************************/
-void BOARD_BootClockFRO24M(void)
+status_t BOARD_BootClockFRO24M(void)
 {
     uint32_t coreFreq;
+    status_t status = kStatus_Success;
+    uint32_t traceState = BOARD_StateTraceSet((uint32_t)kSTATE_TRACE_ClockSwitch);
     spc_active_mode_core_ldo_option_t ldoOption;
-    spc_sram_voltage_config_t sramOption;
+    spc_regulator_transaction_t regulators;
 
     /* Get the CPU Core frequency */
     coreFreq = CLOCK_GetCoreSysClkFreq();
 
+    /* Regulators of the target frequency: one ordered commit, with a single SPC busy wait. */
+    SPC_BeginRegulatorTransaction(&regulators);
+    ldoOption.CoreLDOVoltage = kSPC_CoreLDO_MidDriveVoltage;
+    ldoOption.CoreLDODriveStrength = kSPC_CoreLDO_NormalDriveStrength;
+    SPC_StageActiveModeCoreLDORegulatorConfig(&regulators, &ldoOption);
+    /* Specifies the operating voltage for the SRAM's read/write timing margin */
+    SPC_StageSRAMOperateVoltage(&regulators, kSPC_sramOperateAt1P0V);
+
     /* The flow of increasing voltage and frequency */
     if (coreFreq <= BOARD_BOOTCLOCKFRO24M_CORE_CLOCK) {
-        /* Set the LDO_CORE VDD regulator level */
-        ldoOption.CoreLDOVoltage = kSPC_CoreLDO_MidDriveVoltage;
-        ldoOption.CoreLDODriveStrength = kSPC_CoreLDO_NormalDriveStrength;
-        (void)SPC_SetActiveModeCoreLDORegulatorConfig(SPC0, &ldoOption);
+        status = SPC_CommitRegulatorTransaction(SPC0, &regulators);
+        if (status != kStatus_Success) {
+            /* The regulators may not support the target frequency: keep the current clock and wait states */
+            (void)BOARD_StateTraceSet(traceState);
+            return status;
+        }
         /* Configure Flash to support different voltage level and frequency */
         FMU0->FCTRL = (FMU0->FCTRL & ~((uint32_t)FMU_FCTRL_RWSC_MASK)) | (FMU_FCTRL_RWSC(0x0U));
-        /* Specifies the operating voltage for the SRAM's read/write timing margin */
-        sramOption.operateVoltage = kSPC_sramOperateAt1P0V;
-        sramOption.requestVoltageUpdate =  true;
-        (void)SPC_SetSRAMOperateVoltage(SPC0, &sramOption);
     }
 
     CLOCK_SetupFROHFClocking(48000000U);               /*!< Enable FRO HF(48MHz) output */
@@ -207,14 +223,8 @@ void BOARD_BootClockFRO24M(void)
     if (coreFreq > BOARD_BOOTCLOCKFRO24M_CORE_CLOCK) {
         /* Configure Flash to support different voltage level and frequency */
         FMU0->FCTRL = (FMU0->FCTRL & ~((uint32_t)FMU_FCTRL_RWSC_MASK)) | (FMU_FCTRL_RWSC(0x0U));
-        /* Specifies the operating voltage for the SRAM's read/write timing margin */
-        sramOption.operateVoltage = kSPC_sramOperateAt1P0V;
-        sramOption.requestVoltageUpdate =  true;
-        (void)SPC_SetSRAMOperateVoltage(SPC0, &sramOption);
-        /* Set the LDO_CORE VDD regulator level */
-        ldoOption.CoreLDOVoltage = kSPC_CoreLDO_MidDriveVoltage;
-        ldoOption.CoreLDODriveStrength = kSPC_CoreLDO_NormalDriveStrength;
-        (void)SPC_SetActiveModeCoreLDORegulatorConfig(SPC0, &ldoOption);
+        /* The clock is already lower: a failed commit leaves the regulators at their previous, higher level */
+        status = SPC_CommitRegulatorTransaction(SPC0, &regulators);
     }
 
     /*!< Set up clock selectors - Attach clocks to the peripheries */
@@ -225,6 +235,10 @@ void BOARD_BootClockFRO24M(void)
 
     /* Set SystemCoreClock variable */
     SystemCoreClock = BOARD_BOOTCLOCKFRO24M_CORE_CLOCK;
+
+    (void)BOARD_StateTraceSet(traceState);
+
+    return status;
 }
 /*******************************************************************************
  ******************** Configuration BOARD_BootClockFRO48M **********************
@@ -254,33 +268,46 @@ settings:
 /*******************************************************************************
  * Code for BOARD_BootClockFRO48M configuration
  ******************************************************************************/
-void BOARD_BootClockFRO48M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_core_ldo_drive_strength_t active_ldo_strength, spc_core_ldo_voltage_level_t lowpower_ldo_voltage, spc_core_ldo_drive_strength_t lowpower_ldo_strength)
+status_t BOARD_BootClockFRO48M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_core_ldo_drive_strength_t active_ldo_strength, spc_core_ldo_voltage_level_t lowpower_ldo_voltage, spc_core_ldo_drive_strength_t lowpower_ldo_strength)
 {
     uint32_t coreFreq;
+    status_t status = kStatus_Success;
+    uint32_t traceState = BOARD_StateTraceSet((uint32_t)kSTATE_TRACE_ClockSwitch);
     spc_active_mode_core_ldo_option_t ldoOption;
     spc_lowpower_mode_core_ldo_option_t lowpower_ldoOption;
-    spc_sram_voltage_config_t sramOption;
+    spc_regulator_transaction_t regulators;
 
     /* Get the CPU Core frequency */
     coreFreq = CLOCK_GetCoreSysClkFreq();
 
+    /* Regulators of the target frequency: one ordered commit, with a single SPC busy wait. */
+    SPC_BeginRegulatorTransaction(&regulators);
+    ldoOption.CoreLDOVoltage = active_ldo_voltage;
+    ldoOption.CoreLDODriveStrength = active_ldo_strength;
+    SPC_StageActiveModeCoreLDORegulatorConfig(&regulators, &ldoOption);
+    lowpower_ldoOption.CoreLDOVoltage = lowpower_ldo_voltage;
+    lowpower_ldoOption.CoreLDODriveStrength = lowpower_ldo_strength;
+    SPC_StageLowPowerModeCoreLDORegulatorConfig(&regulators, &lowpower_ldoOption);
+    /* The bandgap is only kept in low power modes for a normal drive strength. */
+    SPC_StageLowPowerModeBandgapmodeConfig(&regulators, (lowpower_ldo_strength == kSPC_CoreLDO_NormalDriveStrength) ?
+                                                            kSPC_BandgapEnabledBufferDisabled : kSPC_BandgapDisabled);
+    if (lowpower_ldo_strength != kSPC_CoreLDO_NormalDriveStrength) {
+        /* The glitch detect must be disabled along with the bandgap. */
+        SPC_StageDisableLowPowerModeVddCoreGlitchDetect(&regulators, true);
+    }
+    /* Specifies the operating voltage for the SRAM's read/write timing margin */
+    SPC_StageSRAMOperateVoltage(&regulators, kSPC_sramOperateAt1P0V);
+
     /* The flow of increasing voltage and frequency */
     if (coreFreq <= BOARD_BOOTCLOCKFRO48M_CORE_CLOCK) {
-        /* Set the LDO_CORE VDD regulator level */
-        ldoOption.CoreLDOVoltage = active_ldo_voltage;
-        ldoOption.CoreLDODriveStrength = active_ldo_strength;
-        (void)SPC_SetActiveModeCoreLDORegulatorConfig(SPC0, &ldoOption);
-        SPC_SetLowPowerModeBandgapmodeConfig(SPC0, kSPC_BandgapEnabledBufferDisabled);
-        lowpower_ldoOption.CoreLDOVoltage = lowpower_ldo_voltage;
-        lowpower_ldoOption.CoreLDODriveStrength = lowpower_ldo_strength;
-        (void)SPC_SetLowPowerModeCoreLDORegulatorConfig(SPC0, &lowpower_ldoOption);
-        SPC_SetLowPowerModeBandgapmodeConfig(SPC0, kSPC_BandgapDisabled);
+        status = SPC_CommitRegulatorTransaction(SPC0, &regulators);
+        if (status != kStatus_Success) {
+            /* The regulators may not support the target frequency: keep the current clock and wait states */
+            (void)BOARD_StateTraceSet(traceState);
+            return status;
+        }
         /* Configure Flash to support different voltage level and frequency */
         FMU0->FCTRL = (FMU0->FCTRL & ~((uint32_t)FMU_FCTRL_RWSC_MASK)) | (FMU_FCTRL_RWSC(0x1U));
-        /* Specifies the operating voltage for the SRAM's read/write timing margin */
-        sramOption.operateVoltage = kSPC_sramOperateAt1P0V;
-        sramOption.requestVoltageUpdate =  true;
-        (void)SPC_SetSRAMOperateVoltage(SPC0, &sramOption);
     }
 
     CLOCK_SetupFROHFClocking(48000000U);               /*!< Enable FRO HF(48MHz) output */
@@ -293,19 +320,8 @@ void BOARD_BootClockFRO48M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_
     if (coreFreq > BOARD_BOOTCLOCKFRO48M_CORE_CLOCK) {
         /* Configure Flash to support different voltage level and frequency */
         FMU0->FCTRL = (FMU0->FCTRL & ~((uint32_t)FMU_FCTRL_RWSC_MASK)) | (FMU_FCTRL_RWSC(0x1U));
-        /* Specifies the operating voltage for the SRAM's read/write timing margin */
-        sramOption.operateVoltage = kSPC_sramOperateAt1P0V;
-        sramOption.requestVoltageUpdate =  true;
-        (void)SPC_SetSRAMOperateVoltage(SPC0, &sramOption);
-        /* Set the LDO_CORE VDD regulator level */
-        ldoOption.CoreLDOVoltage = active_ldo_voltage;
-        ldoOption.CoreLDODriveStrength = active_ldo_strength;
-        (void)SPC_SetActiveModeCoreLDORegulatorConfig(SPC0, &ldoOption);
-        SPC_SetLowPowerModeBandgapmodeConfig(SPC0, kSPC_BandgapEnabledBufferDisabled);
-        lowpower_ldoOption.CoreLDOVoltage = lowpower_ldo_voltage;
-        lowpower_ldoOption.CoreLDODriveStrength = lowpower_ldo_strength;
-        (void)SPC_SetLowPowerModeCoreLDORegulatorConfig(SPC0, &lowpower_ldoOption);
-        SPC_SetLowPowerModeBandgapmodeConfig(SPC0, kSPC_BandgapDisabled);
+        /* The clock is already lower: a failed commit leaves the regulators at their previous, higher level */
+        status = SPC_CommitRegulatorTransaction(SPC0, &regulators);
     }
 
     /*!< Set up clock selectors - Attach clocks to the peripheries */
@@ -316,6 +332,10 @@ void BOARD_BootClockFRO48M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_
 
     /* Set SystemCoreClock variable */
     SystemCoreClock = BOARD_BOOTCLOCKFRO48M_CORE_CLOCK;
+
+    (void)BOARD_StateTraceSet(traceState);
+
+    return status;
 }
 /*******************************************************************************
  ******************** Configuration BOARD_BootClockFRO64M **********************
@@ -350,27 +370,35 @@ sources:
 /*******************************************************************************
  * Code for BOARD_BootClockFRO64M configuration
  ******************************************************************************/
-void BOARD_BootClockFRO64M(void)
+status_t BOARD_BootClockFRO64M(void)
 {
     uint32_t coreFreq;
+    status_t status = kStatus_Success;
+    uint32_t traceState = BOARD_StateTraceSet((uint32_t)kSTATE_TRACE_ClockSwitch);
     spc_active_mode_core_ldo_option_t ldoOption;
-    spc_sram_voltage_config_t sramOption;
+    spc_regulator_transaction_t regulators;
 
     /* Get the CPU Core frequency */
     coreFreq = CLOCK_GetCoreSysClkFreq();
 
+    /* Regulators of the target frequency: one ordered commit, with a single SPC busy wait. */
+    SPC_BeginRegulatorTransaction(&regulators);
+    ldoOption.CoreLDOVoltage = kSPC_CoreLDO_NormalVoltage;
+    ldoOption.CoreLDODriveStrength = kSPC_CoreLDO_NormalDriveStrength;
+    SPC_StageActiveModeCoreLDORegulatorConfig(&regulators, &ldoOption);
+    /* Specifies the operating voltage for the SRAM's read/write timing margin */
+    SPC_StageSRAMOperateVoltage(&regulators, kSPC_sramOperateAt1P1V);
+
     /* The flow of increasing voltage and frequency */
     if (coreFreq <= BOARD_BOOTCLOCKFRO64M_CORE_CLOCK) {
-        /* Set the LDO_CORE VDD regulator level */
-        ldoOption.CoreLDOVoltage = kSPC_CoreLDO_NormalVoltage;
-        ldoOption.CoreLDODriveStrength = kSPC_CoreLDO_NormalDriveStrength;
-        (void)SPC_SetActiveModeCoreLDORegulatorConfig(SPC0, &ldoOption);
+        status = SPC_CommitRegulatorTransaction(SPC0, &regulators);
+        if (status != kStatus_Success) {
+            /* The regulators may not support the target frequency: keep the current clock and wait states */
+            (void)BOARD_StateTraceSet(traceState);
+            return status;
+        }
         /* Configure Flash to support different voltage level and frequency */
         FMU0->FCTRL = (FMU0->FCTRL & ~((uint32_t)FMU_FCTRL_RWSC_MASK)) | (FMU_FCTRL_RWSC(0x1U));
-        /* Specifies the operating voltage for the SRAM's read/write timing margin */
-        sramOption.operateVoltage = kSPC_sramOperateAt1P1V;
-        sramOption.requestVoltageUpdate =  true;
-        (void)SPC_SetSRAMOperateVoltage(SPC0, &sramOption);
     }
 
     CLOCK_SetupFROHFClocking(64000000U);               /*!< Enable FRO HF(64MHz) output */
@@ -383,14 +411,8 @@ void BOARD_BootClockFRO64M(void)
     if (coreFreq > BOARD_BOOTCLOCKFRO64M_CORE_CLOCK) {
         /* Configure Flash to support different voltage level and frequency */
         FMU0->FCTRL = (FMU0->FCTRL & ~((uint32_t)FMU_FCTRL_RWSC_MASK)) | (FMU_FCTRL_RWSC(0x1U));
-        /* Specifies the operating voltage for the SRAM's read/write timing margin */
-        sramOption.operateVoltage = kSPC_sramOperateAt1P1V;
-        sramOption.requestVoltageUpdate =  true;
-        (void)SPC_SetSRAMOperateVoltage(SPC0, &sramOption);
-        /* Set the LDO_CORE VDD regulator level */
-        ldoOption.CoreLDOVoltage = kSPC_CoreLDO_NormalVoltage;
-        ldoOption.CoreLDODriveStrength = kSPC_CoreLDO_NormalDriveStrength;
-        (void)SPC_SetActiveModeCoreLDORegulatorConfig(SPC0, &ldoOption);
+        /* The clock is already lower: a failed commit leaves the regulators at their previous, higher level */
+        status = SPC_CommitRegulatorTransaction(SPC0, &regulators);
     }
 
     /*!< Set up clock selectors - Attach clocks to the peripheries */
@@ -401,6 +423,10 @@ void BOARD_BootClockFRO64M(void)
 
     /* Set SystemCoreClock variable */
     SystemCoreClock = BOARD_BOOTCLOCKFRO64M_CORE_CLOCK;
+
+    (void)BOARD_StateTraceSet(traceState);
+
+    return status;
 }
 /*******************************************************************************
  ******************** Configuration BOARD_BootClockFRO96M **********************
@@ -437,33 +463,46 @@ sources:
 /*******************************************************************************
  * Code for BOARD_BootClockFRO96M configuration
  ******************************************************************************/
-void BOARD_BootClockFRO96M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_core_ldo_drive_strength_t active_ldo_strength, spc_core_ldo_voltage_level_t lowpower_ldo_voltage, spc_core_ldo_drive_strength_t lowpower_ldo_strength)
+status_t BOARD_BootClockFRO96M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_core_ldo_drive_strength_t active_ldo_strength, spc_core_ldo_voltage_level_t lowpower_ldo_voltage, spc_core_ldo_drive_strength_t lowpower_ldo_strength)
 {
     uint32_t coreFreq;
+    status_t status = kStatus_Success;
+    uint32_t traceState = BOARD_StateTraceSet((uint32_t)kSTATE_TRACE_ClockSwitch);
     spc_active_mode_core_ldo_option_t ldoOption;
     spc_lowpower_mode_core_ldo_option_t lowpower_ldoOption;
-    spc_sram_voltage_config_t sramOption;
+    spc_regulator_transaction_t regulators;
 
     /* Get the CPU Core frequency */
     coreFreq = CLOCK_GetCoreSysClkFreq();
 
+    /* Regulators of the target frequency: one ordered commit, with a single SPC busy wait. */
+    SPC_BeginRegulatorTransaction(&regulators);
+    ldoOption.CoreLDOVoltage = active_ldo_voltage;
+    ldoOption.CoreLDODriveStrength = active_ldo_strength;
+    SPC_StageActiveModeCoreLDORegulatorConfig(&regulators, &ldoOption);
+    lowpower_ldoOption.CoreLDOVoltage = lowpower_ldo_voltage;
+    lowpower_ldoOption.CoreLDODriveStrength = lowpower_ldo_strength;
+    SPC_StageLowPowerModeCoreLDORegulatorConfig(&regulators, &lowpower_ldoOption);
+    /* The bandgap is only kept in low power modes for a normal drive strength. */
+    SPC_StageLowPowerModeBandgapmodeConfig(&regulators, (lowpower_ldo_strength == kSPC_CoreLDO_NormalDriveStrength) ?
+                                                            kSPC_BandgapEnabledBufferDisabled : kSPC_BandgapDisabled);
+    if (lowpower_ldo_strength != kSPC_CoreLDO_NormalDriveStrength) {
+        /* The glitch detect must be disabled along with the bandgap. */
+        SPC_StageDisableLowPowerModeVddCoreGlitchDetect(&regulators, true);
+    }
+    /* Specifies the operating voltage for the SRAM's read/write timing margin */
+    SPC_StageSRAMOperateVoltage(&regulators, kSPC_sramOperateAt1P1V);
+
     /* The flow of increasing voltage and frequency */
     if (coreFreq <= BOARD_BOOTCLOCKFRO96M_CORE_CLOCK) {
-        /* Set the LDO_CORE VDD regulator level */
-        ldoOption.CoreLDOVoltage = active_ldo_voltage;
-        ldoOption.CoreLDODriveStrength = active_ldo_strength;
-        (void)SPC_SetActiveModeCoreLDORegulatorConfig(SPC0, &ldoOption);
-        SPC_SetLowPowerModeBandgapmodeConfig(SPC0, kSPC_BandgapEnabledBufferDisabled);
-        lowpower_ldoOption.CoreLDOVoltage = lowpower_ldo_voltage;
-        lowpower_ldoOption.CoreLDODriveStrength = lowpower_ldo_strength;
-        (void)SPC_SetLowPowerModeCoreLDORegulatorConfig(SPC0, &lowpower_ldoOption);
-        SPC_SetLowPowerModeBandgapmodeConfig(SPC0, kSPC_BandgapDisabled);
+        status = SPC_CommitRegulatorTransaction(SPC0, &regulators);
+        if (status != kStatus_Success) {
+            /* The regulators may not support the target frequency: keep the current clock and wait states */
+            (void)BOARD_StateTraceSet(traceState);
+            return status;
+        }
         /* Configure Flash to support different voltage level and frequency */
         FMU0->FCTRL = (FMU0->FCTRL & ~((uint32_t)FMU_FCTRL_RWSC_MASK)) | (FMU_FCTRL_RWSC(0x2U));
-        /* Specifies the operating voltage for the SRAM's read/write timing margin */
-        sramOption.operateVoltage = kSPC_sramOperateAt1P1V;
-        sramOption.requestVoltageUpdate =  true;
-        (void)SPC_SetSRAMOperateVoltage(SPC0, &sramOption);
     }
 
     CLOCK_SetupFROHFClocking(96000000U);               /*!< Enable FRO HF(96MHz) output */
@@ -476,19 +515,8 @@ void BOARD_BootClockFRO96M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_
     if (coreFreq > BOARD_BOOTCLOCKFRO96M_CORE_CLOCK) {
         /* Configure Flash to support different voltage level and frequency */
         FMU0->FCTRL = (FMU0->FCTRL & ~((uint32_t)FMU_FCTRL_RWSC_MASK)) | (FMU_FCTRL_RWSC(0x2U));
-        /* Specifies the operating voltage for the SRAM's read/write timing margin */
-        sramOption.operateVoltage = kSPC_sramOperateAt1P1V;
-        sramOption.requestVoltageUpdate =  true;
-        (void)SPC_SetSRAMOperateVoltage(SPC0, &sramOption);
-        /* Set the LDO_CORE VDD regulator level */
-        ldoOption.CoreLDOVoltage = active_ldo_voltage;
-        ldoOption.CoreLDODriveStrength = active_ldo_strength;
-        (void)SPC_SetActiveModeCoreLDORegulatorConfig(SPC0, &ldoOption);
-        SPC_SetLowPowerModeBandgapmodeConfig(SPC0, kSPC_BandgapEnabledBufferDisabled);
-        lowpower_ldoOption.CoreLDOVoltage = lowpower_ldo_voltage;
-        lowpower_ldoOption.CoreLDODriveStrength = lowpower_ldo_strength;
-        (void)SPC_SetLowPowerModeCoreLDORegulatorConfig(SPC0, &lowpower_ldoOption);
-        SPC_SetLowPowerModeBandgapmodeConfig(SPC0, kSPC_BandgapDisabled);
+        /* The clock is already lower: a failed commit leaves the regulators at their previous, higher level */
+        status = SPC_CommitRegulatorTransaction(SPC0, &regulators);
     }
 
     /*!< Set up clock selectors - Attach clocks to the peripheries */
@@ -499,4 +527,81 @@ void BOARD_BootClockFRO96M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_
 
     /* Set SystemCoreClock variable */
     SystemCoreClock = BOARD_BOOTCLOCKFRO96M_CORE_CLOCK;
+
+    (void)BOARD_StateTraceSet(traceState);
+
+    return status;
+}
+
+status_t BOARD_BootClockFRO96MStart(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_core_ldo_drive_strength_t active_ldo_strength, spc_core_ldo_voltage_level_t lowpower_ldo_voltage, spc_core_ldo_drive_strength_t lowpower_ldo_strength, board_clock_step_t *step)
+{
+    spc_active_mode_core_ldo_option_t ldoOption;
+    spc_lowpower_mode_core_ldo_option_t lowpower_ldoOption;
+    status_t status;
+
+    step->pending = false;
+
+    /* The flow of decreasing voltage and frequency: no regulator latency before the switch */
+    if (CLOCK_GetCoreSysClkFreq() > BOARD_BOOTCLOCKFRO96M_CORE_CLOCK) {
+        return BOARD_BootClockFRO96M(active_ldo_voltage, active_ldo_strength, lowpower_ldo_voltage, lowpower_ldo_strength);
+    }
+
+    /* Same regulators as BOARD_BootClockFRO96M */
+    SPC_BeginRegulatorTransaction(&step->regulators);
+    ldoOption.CoreLDOVoltage = active_ldo_voltage;
+    ldoOption.CoreLDODriveStrength = active_ldo_strength;
+    SPC_StageActiveModeCoreLDORegulatorConfig(&step->regulators, &ldoOption);
+    lowpower_ldoOption.CoreLDOVoltage = lowpower_ldo_voltage;
+    lowpower_ldoOption.CoreLDODriveStrength = lowpower_ldo_strength;
+    SPC_StageLowPowerModeCoreLDORegulatorConfig(&step->regulators, &lowpower_ldoOption);
+    SPC_StageLowPowerModeBandgapmodeConfig(&step->regulators, (lowpower_ldo_strength == kSPC_CoreLDO_NormalDriveStrength) ?
+                                                                  kSPC_BandgapEnabledBufferDisabled : kSPC_BandgapDisabled);
+    if (lowpower_ldo_strength != kSPC_CoreLDO_NormalDriveStrength) {
+        /* The glitch detect must be disabled along with the bandgap. */
+        SPC_StageDisableLowPowerModeVddCoreGlitchDetect(&step->regulators, true);
+    }
+    SPC_StageSRAMOperateVoltage(&step->regulators, kSPC_sramOperateAt1P1V);
+
+    /* The flow of increasing voltage and frequency: the core keeps its clock while the voltage ramps */
+    status = SPC_StartRegulatorTransaction(SPC0, &step->regulators);
+    if (status == kStatus_Success) {
+        step->pending = true;
+    }
+
+    return status;
+}
+
+status_t BOARD_BootClockFRO96MComplete(board_clock_step_t *step)
+{
+    uint32_t traceState;
+
+    if (!step->pending) {
+        return kStatus_Success;
+    }
+    if (SPC_FinishRegulatorTransaction(SPC0, &step->regulators) != kStatus_Success) {
+        return kStatus_SPC_Busy;
+    }
+
+    traceState = BOARD_StateTraceSet((uint32_t)kSTATE_TRACE_ClockSwitch);
+
+    /* Configure Flash to support different voltage level and frequency */
+    FMU0->FCTRL = (FMU0->FCTRL & ~((uint32_t)FMU_FCTRL_RWSC_MASK)) | (FMU_FCTRL_RWSC(0x2U));
+
+    CLOCK_SetupFROHFClocking(96000000U);               /*!< Enable FRO HF(96MHz) output */
+
+    CLOCK_SetupFRO12MClocking();                /*!< Setup FRO12M clock */
+
+    CLOCK_AttachClk(kFRO_HF_to_MAIN_CLK);       /* !< Switch MAIN_CLK to FRO_HF */
+
+    /*!< Set up dividers */
+    CLOCK_SetClockDiv(kCLOCK_DivAHBCLK, 1U);               /* !< Set AHBCLKDIV divider to value 1 */
+    CLOCK_SetClockDiv(kCLOCK_DivFRO_HF_DIV, 1U);           /* !< Set FROHFDIV divider to value 1 */
+
+    /* Set SystemCoreClock variable */
+    SystemCoreClock = BOARD_BOOTCLOCKFRO96M_CORE_CLOCK;
+
+    step->pending = false;
+    (void)BOARD_StateTraceSet(traceState);
+
+    return kStatus_Success;
 }
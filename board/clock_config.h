@@ -19,6 +19,13 @@
  * Definitions
  ******************************************************************************/
 
+/*! @brief Clock configuration started by a BOARD_BootClockxxxStart function and completed by its Complete function. */
+typedef struct _board_clock_step
+{
+    spc_regulator_transaction_t regulators; /*!< Regulator changes in progress. */
+    bool pending;                           /*!< The frequency step waits for the regulators to settle. */
+} board_clock_step_t;
+
 /*******************************************************************************
  ************************ BOARD_InitBootClocks function ************************
  ******************************************************************************/
@@ -56,8 +63,14 @@ extern "C" {
 /*!
  * @brief This function executes configuration of clocks.
  *
+ * When the frequency rises, the regulators are committed first and a failed commit leaves the clocks and
+ * flash wait states unchanged. When it drops, the clock is lowered first and a failed commit leaves the
+ * regulators at their previous, higher level.
+ *
+ * @retval kStatus_Success The clocks run at the target frequency.
+ * @return Otherwise the status of SPC_CommitRegulatorTransaction().
  */
-void BOARD_BootClockFRO12M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_core_ldo_drive_strength_t active_ldo_strength, spc_core_ldo_voltage_level_t lowpower_ldo_voltage, spc_core_ldo_drive_strength_t lowpower_ldo_strength);
+status_t BOARD_BootClockFRO12M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_core_ldo_drive_strength_t active_ldo_strength, spc_core_ldo_voltage_level_t lowpower_ldo_voltage, spc_core_ldo_drive_strength_t lowpower_ldo_strength);
 
 #if defined(__cplusplus)
 }
@@ -82,8 +95,14 @@ extern "C" {
 /*!
  * @brief This function executes configuration of clocks.
  *
+ * When the frequency rises, the regulators are committed first and a failed commit leaves the clocks and
+ * flash wait states unchanged. When it drops, the clock is lowered first and a failed commit leaves the
+ * regulators at their previous, higher level.
+ *
+ * @retval kStatus_Success The clocks run at the target frequency.
+ * @return Otherwise the status of SPC_CommitRegulatorTransaction().
  */
-void BOARD_BootClockFRO24M(void);
+status_t BOARD_BootClockFRO24M(void);
 
 #if defined(__cplusplus)
 }
@@ -108,8 +127,14 @@ extern "C" {
 /*!
  * @brief This function executes configuration of clocks.
  *
+ * When the frequency rises, the regulators are committed first and a failed commit leaves the clocks and
+ * flash wait states unchanged. When it drops, the clock is lowered first and a failed commit leaves the
+ * regulators at their previous, higher level.
+ *
+ * @retval kStatus_Success The clocks run at the target frequency.
+ * @return Otherwise the status of SPC_CommitRegulatorTransaction().
  */
-void BOARD_BootClockFRO48M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_core_ldo_drive_strength_t active_ldo_strength, spc_core_ldo_voltage_level_t lowpower_ldo_voltage, spc_core_ldo_drive_strength_t lowpower_ldo_strength);
+status_t BOARD_BootClockFRO48M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_core_ldo_drive_strength_t active_ldo_strength, spc_core_ldo_voltage_level_t lowpower_ldo_voltage, spc_core_ldo_drive_strength_t lowpower_ldo_strength);
 
 #if defined(__cplusplus)
 }
@@ -134,8 +159,14 @@ extern "C" {
 /*!
  * @brief This function executes configuration of clocks.
  *
+ * When the frequency rises, the regulators are committed first and a failed commit leaves the clocks and
+ * flash wait states unchanged. When it drops, the clock is lowered first and a failed commit leaves the
+ * regulators at their previous, higher level.
+ *
+ * @retval kStatus_Success The clocks run at the target frequency.
+ * @return Otherwise the status of SPC_CommitRegulatorTransaction().
  */
-void BOARD_BootClockFRO64M(void);
+status_t BOARD_BootClockFRO64M(void);
 
 #if defined(__cplusplus)
 }
@@ -160,8 +191,36 @@ extern "C" {
 /*!
  * @brief This function executes configuration of clocks.
  *
+ * When the frequency rises, the regulators are committed first and a failed commit leaves the clocks and
+ * flash wait states unchanged. When it drops, the clock is lowered first and a failed commit leaves the
+ * regulators at their previous, higher level.
+ *
+ * @retval kStatus_Success The clocks run at the target frequency.
+ * @return Otherwise the status of SPC_CommitRegulatorTransaction().
+ */
+status_t BOARD_BootClockFRO96M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_core_ldo_drive_strength_t active_ldo_strength, spc_core_ldo_voltage_level_t lowpower_ldo_voltage, spc_core_ldo_drive_strength_t lowpower_ldo_strength);
+
+/*!
+ * @brief Starts the BOARD_BootClockFRO96M configuration without waiting for the regulators.
+ *
+ * When the frequency rises, starts the regulator changes and returns, the core keeps its current clock.
+ * BOARD_BootClockFRO96MComplete() switches to 96MHz once the regulators have settled. When the frequency
+ * drops, the voltage is lowered after the switch: the whole configuration is done before returning.
+ *
+ * @param step Configuration in progress, passed to BOARD_BootClockFRO96MComplete().
+ * @return kStatus_Success, or the status of SPC_StartRegulatorTransaction() when the frequency rises, on error
+ *         nothing is changed. When it drops, the status of BOARD_BootClockFRO96M().
+ */
+status_t BOARD_BootClockFRO96MStart(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_core_ldo_drive_strength_t active_ldo_strength, spc_core_ldo_voltage_level_t lowpower_ldo_voltage, spc_core_ldo_drive_strength_t lowpower_ldo_strength, board_clock_step_t *step);
+
+/*!
+ * @brief Completes a configuration started by BOARD_BootClockFRO96MStart(), does not wait.
+ *
+ * @param step Configuration in progress.
+ * @retval kStatus_Success The clocks run at 96MHz, or nothing was pending.
+ * @retval kStatus_SPC_Busy The regulators are still settling, call again later.
  */
-void BOARD_BootClockFRO96M(spc_core_ldo_voltage_level_t active_ldo_voltage, spc_core_ldo_drive_strength_t active_ldo_strength, spc_core_ldo_voltage_level_t lowpower_ldo_voltage, spc_core_ldo_drive_strength_t lowpower_ldo_strength);
+status_t BOARD_BootClockFRO96MComplete(board_clock_step_t *step);
 
 #if defined(__cplusplus)
 }
@@ -63,55 +63,31 @@ void BOARD_InitPins(void)
     CLOCK_EnableClock(kCLOCK_GatePORT0);
     CLOCK_EnableClock(kCLOCK_GateGPIO3);
 
-    const port_pin_config_t port0_2_pin51_config = {/* Internal pull-up resistor is enabled */
-                                                    kPORT_PullUp,
-                                                    /* Low internal pull resistor value is selected. */
-                                                    kPORT_LowPullResistor,
-                                                    /* Fast slew rate is configured */
-                                                    kPORT_FastSlewRate,
-                                                    /* Passive input filter is disabled */
-                                                    kPORT_PassiveFilterDisable,
-                                                    /* Open drain output is disabled */
-                                                    kPORT_OpenDrainDisable,
-                                                    /* Low drive strength is configured */
-                                                    kPORT_LowDriveStrength,
-                                                    /* Normal drive strength is configured */
-                                                    kPORT_NormalDriveStrength,
-                                                    /* Pin is configured as LPUART0_RXD */
-                                                    kPORT_MuxAlt2,
-                                                    /* Digital input enabled */
-                                                    kPORT_InputBufferEnable,
-                                                    /* Digital input is not inverted */
-                                                    kPORT_InputNormal,
-                                                    /* Pin Control Register fields [15:0] are not locked */
-                                                    kPORT_UnlockRegister};
-    /* PORT0_2 (pin 51) is configured as LPUART0_RXD */
-    PORT_SetPinConfig(PORT0, 2U, &port0_2_pin51_config);
-
-    const port_pin_config_t port0_3_pin52_config = {/* Internal pull-up resistor is enabled */
-                                                    kPORT_PullUp,
-                                                    /* Low internal pull resistor value is selected. */
-                                                    kPORT_LowPullResistor,
-                                                    /* Fast slew rate is configured */
-                                                    kPORT_FastSlewRate,
-                                                    /* Passive input filter is disabled */
-                                                    kPORT_PassiveFilterDisable,
-                                                    /* Open drain output is disabled */
-                                                    kPORT_OpenDrainDisable,
-                                                    /* Low drive strength is configured */
-                                                    kPORT_LowDriveStrength,
-                                                    /* Normal drive strength is configured */
-                                                    kPORT_NormalDriveStrength,
-                                                    /* Pin is configured as LPUART0_TXD */
-                                                    kPORT_MuxAlt2,
-                                                    /* Digital input enabled */
-                                                    kPORT_InputBufferEnable,
-                                                    /* Digital input is not inverted */
-                                                    kPORT_InputNormal,
-                                                    /* Pin Control Register fields [15:0] are not locked */
-                                                    kPORT_UnlockRegister};
-    /* PORT0_3 (pin 52) is configured as LPUART0_TXD */
-    PORT_SetPinConfig(PORT0, 3U, &port0_3_pin52_config);
+    const port_pin_config_t port0_2_3_pins51_52_config = {/* Internal pull-up resistor is enabled */
+                                                          kPORT_PullUp,
+                                                          /* Low internal pull resistor value is selected. */
+                                                          kPORT_LowPullResistor,
+                                                          /* Fast slew rate is configured */
+                                                          kPORT_FastSlewRate,
+                                                          /* Passive input filter is disabled */
+                                                          kPORT_PassiveFilterDisable,
+                                                          /* Open drain output is disabled */
+                                                          kPORT_OpenDrainDisable,
+                                                          /* Low drive strength is configured */
+                                                          kPORT_LowDriveStrength,
+                                                          /* Normal drive strength is configured */
+                                                          kPORT_NormalDriveStrength,
+                                                          /* Pins are configured as LPUART0_RXD and LPUART0_TXD */
+                                                          kPORT_MuxAlt2,
+                                                          /* Digital input enabled */
+                                                          kPORT_InputBufferEnable,
+                                                          /* Digital input is not inverted */
+                                                          kPORT_InputNormal,
+                                                          /* Pin Control Register fields [15:0] are not locked */
+                                                          kPORT_UnlockRegister};
+    /* PORT0_2 (pin 51) is configured as LPUART0_RXD, PORT0_3 (pin 52) as LPUART0_TXD.
+     * Same settings for both, written together with a single GPCLR store. */
+    PORT_SetMultiplePinsConfig(PORT0, (1UL << 2U) | (1UL << 3U), &port0_2_3_pins51_52_config);
 }
 /***********************************************************************************************************************
  * EOF
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _STATE_TRACE_H_
+#define _STATE_TRACE_H_
+
+#include "fsl_common.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*
+ * State trace bus: a few contiguous GPIO pins carry a binary state code that a
+ * logic analyzer samples. A code change is a single store to the GPIO PTOR
+ * register with (old ^ new), so all bus lines switch on the same clock edge and
+ * no intermediate code is ever visible. Each state lasts until the next code is
+ * written; the time between two edges of the bus is the duration of a phase.
+ *
+ * The trace is meant for the main context. An ISR may trace as long as it
+ * restores the code it found, see BOARD_StateTraceSet().
+ *
+ * The SPC and CMC drivers report their states through SDK_TraceState(), which
+ * board.c overrides while the bus is enabled, see _sdk_trace_state.
+ */
+
+/*! @brief Enable the state trace bus (1 - enable, 0 - disable). */
+#ifndef BOARD_STATE_TRACE_ENABLE
+#define BOARD_STATE_TRACE_ENABLE (0U)
+#endif
+
+/*! @brief State trace bus pins, BOARD_STATE_TRACE_WIDTH pins starting at BOARD_STATE_TRACE_FIRST_PIN. */
+#ifndef BOARD_STATE_TRACE_GPIO
+#define BOARD_STATE_TRACE_GPIO       GPIO2
+#define BOARD_STATE_TRACE_PORT       PORT2
+#define BOARD_STATE_TRACE_GPIO_CLOCK kCLOCK_GateGPIO2
+#define BOARD_STATE_TRACE_PORT_CLOCK kCLOCK_GatePORT2
+#define BOARD_STATE_TRACE_FIRST_PIN  12U
+#endif
+#ifndef BOARD_STATE_TRACE_WIDTH
+#define BOARD_STATE_TRACE_WIDTH (3U)
+#endif
+
+#define BOARD_STATE_TRACE_MASK ((1UL << BOARD_STATE_TRACE_WIDTH) - 1UL)
+
+/*! @brief State codes driven on the trace bus. */
+typedef enum _state_trace_code
+{
+    kSTATE_TRACE_Active      = kSDK_TraceStateActive,      /*!< Application code running. */
+    kSTATE_TRACE_ClockSwitch = 1U,                         /*!< BOARD_BootClockxxx clock and regulator switch. */
+    kSTATE_TRACE_SpcBusyWait = kSDK_TraceStateSpcBusyWait, /*!< Waiting for the SPC busy flag to clear. */
+    kSTATE_TRACE_ModeEntry   = kSDK_TraceStateModeEntry,   /*!< Low power mode entry, last code before WFE/WFI. */
+    kSTATE_TRACE_WakeUp      = kSDK_TraceStateWakeUp,      /*!< First instruction after the core wakes up. */
+    kSTATE_TRACE_ConsoleInit = 5U,                         /*!< Debug console re-initialization after wake up. */
+    kSTATE_TRACE_Idle        = 6U,                         /*!< Scheduler idle hook. */
+    kSTATE_TRACE_User        = 7U,                         /*!< Free for application use. */
+} state_trace_code_t;
+
+#if (defined(BOARD_STATE_TRACE_ENABLE) && (BOARD_STATE_TRACE_ENABLE > 0U))
+/* Code currently driven on the bus. */
+extern uint32_t g_boardStateTraceCode;
+#endif
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Configures the state trace pins as outputs driving kSTATE_TRACE_Active.
+ */
+void BOARD_InitStateTrace(void);
+
+/*!
+ * @brief Drives a new state code on the trace bus.
+ *
+ * @param code New state code.
+ * @return The code that was driven before, pass it back to restore the enclosing state.
+ */
+static inline uint32_t BOARD_StateTraceSet(uint32_t code)
+{
+#if (defined(BOARD_STATE_TRACE_ENABLE) && (BOARD_STATE_TRACE_ENABLE > 0U))
+    uint32_t previous = g_boardStateTraceCode;
+
+    BOARD_STATE_TRACE_GPIO->PTOR = ((previous ^ code) & BOARD_STATE_TRACE_MASK) << BOARD_STATE_TRACE_FIRST_PIN;
+    g_boardStateTraceCode        = code;
+
+    return previous;
+#else
+    (void)code;
+    return (uint32_t)kSTATE_TRACE_Active;
+#endif
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* _STATE_TRACE_H_ */
@@ -343,11 +343,19 @@ list_status_t LIST_RemoveElement(list_element_handle_t listElement)
             if (listElement->list->head == listElement)
             {
                 listElement->list->head = element_list->next;
+                if (listElement->list->tail == listElement) /*Element is solo*/
+                {
+                    listElement->list->tail = NULL;
+                }
                 break;
             }
             if (element_list->next == listElement)
             {
                 element_list->next = listElement->next;
+                if (listElement->list->tail == listElement) /*Element is tail*/
+                {
+                    listElement->list->tail = element_list;
+                }
                 break;
             }
             element_list = element_list->next;
@@ -0,0 +1,440 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*! *********************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+********************************************************************************** */
+#include "fsl_component_pool_list.h"
+
+#define POOL_LIST_ENTER_CRITICAL() uint32_t regPrimask = DisableGlobalIRQ();
+#define POOL_LIST_EXIT_CRITICAL()  EnableGlobalIRQ(regPrimask);
+
+static inline void POOL_LIST_SetMember(pool_list_handle_t list, pool_list_index_t index)
+{
+    list->member[index >> 5U] |= (1UL << (index & 0x1FU));
+}
+
+static inline void POOL_LIST_ClearMember(pool_list_handle_t list, pool_list_index_t index)
+{
+    list->member[index >> 5U] &= ~(1UL << (index & 0x1FU));
+}
+
+static inline void POOL_LIST_SetAllocated(pool_list_handle_t list, pool_list_index_t index)
+{
+    list->allocated[index >> 5U] |= (1UL << (index & 0x1FU));
+}
+
+static inline void POOL_LIST_ClearAllocated(pool_list_handle_t list, pool_list_index_t index)
+{
+    list->allocated[index >> 5U] &= ~(1UL << (index & 0x1FU));
+}
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+********************************************************************************** */
+/*! *********************************************************************************
+ * \brief     Initializes the pool list descriptor.
+ *
+ * \param[in] list - POOL_LIST_ handle to init.
+ *            nodes - link array of max entries.
+ *            member - membership bitmap.
+ *            allocated - allocation bitmap.
+ *            max - Number of element slots.
+ *
+ * \return void.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks   Every slot is chained into the free list through its next link.
+ *
+ ********************************************************************************** */
+void POOL_LIST_Init(
+    pool_list_handle_t list, pool_list_node_t *nodes, uint32_t *member, uint32_t *allocated, uint16_t max)
+{
+    uint32_t i;
+
+    assert(max < POOL_LIST_MAX_ELEMENTS);
+
+    list->nodes     = nodes;
+    list->member    = member;
+    list->allocated = allocated;
+    list->head      = POOL_LIST_INVALID_INDEX;
+    list->tail      = POOL_LIST_INVALID_INDEX;
+    list->freeHead  = (max == 0U) ? POOL_LIST_INVALID_INDEX : 0U;
+    list->size      = 0U;
+    list->max       = max;
+    list->freeCount = max;
+
+    for (i = 0U; i < max; i++)
+    {
+        nodes[i].next = ((i + 1U) < max) ? (pool_list_index_t)(i + 1U) : POOL_LIST_INVALID_INDEX;
+        nodes[i].prev = POOL_LIST_INVALID_INDEX;
+    }
+    for (i = 0U; i < POOL_LIST_BITMAP_WORDS(max); i++)
+    {
+        member[i]    = 0U;
+        allocated[i] = 0U;
+    }
+}
+
+/*! *********************************************************************************
+ * \brief     Takes a free slot from the pool.
+ *
+ * \param[in] list - ID of the list.
+ *
+ * \return POOL_LIST_INVALID_INDEX if the pool is exhausted.
+ *         Index of the slot otherwise.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+pool_list_index_t POOL_LIST_Alloc(pool_list_handle_t list)
+{
+    pool_list_index_t index;
+
+    POOL_LIST_ENTER_CRITICAL();
+
+    index = list->freeHead;
+    if (index != POOL_LIST_INVALID_INDEX)
+    {
+        list->freeHead          = list->nodes[index].next;
+        list->nodes[index].next = POOL_LIST_INVALID_INDEX;
+        list->nodes[index].prev = POOL_LIST_INVALID_INDEX;
+        POOL_LIST_SetAllocated(list, index);
+        list->freeCount--;
+    }
+
+    POOL_LIST_EXIT_CRITICAL();
+    return index;
+}
+
+/*! *********************************************************************************
+ * \brief     Returns a slot to the pool.
+ *
+ * \param[in] list - ID of the list.
+ *            index - index of the slot.
+ *
+ * \return kLIST_OrphanElement if the slot is not allocated.
+ *         kLIST_DuplicateError if the element is still linked.
+ *         kLIST_Ok otherwise.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+list_status_t POOL_LIST_Free(pool_list_handle_t list, pool_list_index_t index)
+{
+    list_status_t listStatus = kLIST_Ok;
+
+    assert(index < list->max);
+
+    POOL_LIST_ENTER_CRITICAL();
+
+    if (!POOL_LIST_IsAllocated(list, index))
+    {
+        listStatus = kLIST_OrphanElement; /*Slot was already freed or never allocated*/
+    }
+    else if (POOL_LIST_IsMember(list, index))
+    {
+        listStatus = kLIST_DuplicateError; /*Element must be unlinked first*/
+    }
+    else
+    {
+        list->nodes[index].next = list->freeHead;
+        list->freeHead          = index;
+        POOL_LIST_ClearAllocated(list, index);
+        list->freeCount++;
+    }
+
+    POOL_LIST_EXIT_CRITICAL();
+    return listStatus;
+}
+
+/*! *********************************************************************************
+ * \brief     Links element to the tail of the list.
+ *
+ * \param[in] list - ID of list to insert into.
+ *            index - element to add
+ *
+ * \return kLIST_OrphanElement if the slot is not allocated.
+ *         kLIST_DuplicateError if the element is already linked.
+ *         kLIST_Ok if insertion was successful.
+ *
+ * \pre       index was obtained from POOL_LIST_Alloc().
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+list_status_t POOL_LIST_AddTail(pool_list_handle_t list, pool_list_index_t index)
+{
+    list_status_t listStatus = kLIST_Ok;
+
+    assert(index < list->max);
+
+    POOL_LIST_ENTER_CRITICAL();
+
+    if (!POOL_LIST_IsAllocated(list, index))
+    {
+        listStatus = kLIST_OrphanElement; /*Slot was never allocated or already freed*/
+    }
+    else if (POOL_LIST_IsMember(list, index))
+    {
+        listStatus = kLIST_DuplicateError;
+    }
+    else
+    {
+        if (list->size == 0U)
+        {
+            list->head = index;
+        }
+        else
+        {
+            list->nodes[list->tail].next = index;
+        }
+        list->nodes[index].prev = list->tail;
+        list->nodes[index].next = POOL_LIST_INVALID_INDEX;
+        list->tail              = index;
+        POOL_LIST_SetMember(list, index);
+        list->size++;
+    }
+
+    POOL_LIST_EXIT_CRITICAL();
+    return listStatus;
+}
+
+/*! *********************************************************************************
+ * \brief     Links element to the head of the list.
+ *
+ * \param[in] list - ID of list to insert into.
+ *            index - element to add
+ *
+ * \return kLIST_OrphanElement if the slot is not allocated.
+ *         kLIST_DuplicateError if the element is already linked.
+ *         kLIST_Ok if insertion was successful.
+ *
+ * \pre       index was obtained from POOL_LIST_Alloc().
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+list_status_t POOL_LIST_AddHead(pool_list_handle_t list, pool_list_index_t index)
+{
+    list_status_t listStatus = kLIST_Ok;
+
+    assert(index < list->max);
+
+    POOL_LIST_ENTER_CRITICAL();
+
+    if (!POOL_LIST_IsAllocated(list, index))
+    {
+        listStatus = kLIST_OrphanElement; /*Slot was never allocated or already freed*/
+    }
+    else if (POOL_LIST_IsMember(list, index))
+    {
+        listStatus = kLIST_DuplicateError;
+    }
+    else
+    {
+        if (list->size == 0U)
+        {
+            list->tail = index;
+        }
+        else
+        {
+            list->nodes[list->head].prev = index;
+        }
+        list->nodes[index].prev = POOL_LIST_INVALID_INDEX;
+        list->nodes[index].next = list->head;
+        list->head              = index;
+        POOL_LIST_SetMember(list, index);
+        list->size++;
+    }
+
+    POOL_LIST_EXIT_CRITICAL();
+    return listStatus;
+}
+
+/*! *********************************************************************************
+ * \brief     Unlinks element from the head of the list.
+ *
+ * \param[in] list - ID of list to remove from.
+ *
+ * \return POOL_LIST_INVALID_INDEX if list is empty.
+ *         Index of removed element if removal was successful.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+pool_list_index_t POOL_LIST_RemoveHead(pool_list_handle_t list)
+{
+    pool_list_index_t index;
+
+    POOL_LIST_ENTER_CRITICAL();
+
+    index = list->head;
+    if (index != POOL_LIST_INVALID_INDEX)
+    {
+        list->head = list->nodes[index].next;
+        list->size--;
+        if (list->size == 0U)
+        {
+            list->tail = POOL_LIST_INVALID_INDEX;
+        }
+        else
+        {
+            list->nodes[list->head].prev = POOL_LIST_INVALID_INDEX;
+        }
+        list->nodes[index].next = POOL_LIST_INVALID_INDEX;
+        POOL_LIST_ClearMember(list, index);
+    }
+
+    POOL_LIST_EXIT_CRITICAL();
+    return index;
+}
+
+/*! *********************************************************************************
+ * \brief     Unlinks an element from the list.
+ *
+ * \param[in] list - ID of the list.
+ *            index - index of the element to remove.
+ *
+ * \return kLIST_OrphanElement if element is not part of the list.
+ *         kLIST_Ok if removal was successful.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+list_status_t POOL_LIST_RemoveElement(pool_list_handle_t list, pool_list_index_t index)
+{
+    list_status_t listStatus = kLIST_Ok;
+    pool_list_node_t *node;
+
+    assert(index < list->max);
+
+    POOL_LIST_ENTER_CRITICAL();
+
+    if (!POOL_LIST_IsMember(list, index))
+    {
+        listStatus = kLIST_OrphanElement; /*Element was previusly removed or never added*/
+    }
+    else
+    {
+        node = &list->nodes[index];
+        if (node->prev == POOL_LIST_INVALID_INDEX) /*Element is head or solo*/
+        {
+            list->head = node->next;
+        }
+        else
+        {
+            list->nodes[node->prev].next = node->next;
+        }
+        if (node->next == POOL_LIST_INVALID_INDEX) /*Element is tail or solo*/
+        {
+            list->tail = node->prev;
+        }
+        else
+        {
+            list->nodes[node->next].prev = node->prev;
+        }
+        node->next = POOL_LIST_INVALID_INDEX;
+        node->prev = POOL_LIST_INVALID_INDEX;
+        POOL_LIST_ClearMember(list, index);
+        list->size--;
+    }
+
+    POOL_LIST_EXIT_CRITICAL();
+    return listStatus;
+}
+
+/*! *********************************************************************************
+ * \brief     Links an element in the previous position relative to a given member
+ *            of the list.
+ *
+ * \param[in] list - ID of the list.
+ *            index - index of a member of the list.
+ *            newIndex - new element to insert before the given member.
+ *
+ * \return kLIST_OrphanElement if element is not part of the list or the new
+ *         slot is not allocated.
+ *         kLIST_DuplicateError if the new element is already linked.
+ *         kLIST_Ok if insertion was successful.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+list_status_t POOL_LIST_AddPrevElement(pool_list_handle_t list, pool_list_index_t index, pool_list_index_t newIndex)
+{
+    list_status_t listStatus = kLIST_Ok;
+    pool_list_index_t prev;
+
+    assert((index < list->max) && (newIndex < list->max));
+
+    POOL_LIST_ENTER_CRITICAL();
+
+    if (!POOL_LIST_IsMember(list, index))
+    {
+        listStatus = kLIST_OrphanElement; /*Element was previusly removed or never added*/
+    }
+    else if (!POOL_LIST_IsAllocated(list, newIndex))
+    {
+        listStatus = kLIST_OrphanElement; /*Slot was never allocated or already freed*/
+    }
+    else if (POOL_LIST_IsMember(list, newIndex))
+    {
+        listStatus = kLIST_DuplicateError;
+    }
+    else
+    {
+        prev = list->nodes[index].prev;
+        if (prev == POOL_LIST_INVALID_INDEX) /*Element is list head*/
+        {
+            list->head = newIndex;
+        }
+        else
+        {
+            list->nodes[prev].next = newIndex;
+        }
+        list->nodes[newIndex].prev = prev;
+        list->nodes[newIndex].next = index;
+        list->nodes[index].prev    = newIndex;
+        POOL_LIST_SetMember(list, newIndex);
+        list->size++;
+    }
+
+    POOL_LIST_EXIT_CRITICAL();
+    return listStatus;
+}
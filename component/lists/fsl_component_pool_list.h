@@ -0,0 +1,275 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _POOL_LIST_H_
+#define _POOL_LIST_H_
+
+#include "fsl_component_generic_list.h"
+
+/*!
+ * @addtogroup PoolList
+ * @{
+ */
+
+/**********************************************************************************
+ * Include
+ ***********************************************************************************/
+
+/**********************************************************************************
+ * Public macro definitions
+ ***********************************************************************************/
+/*! @brief Index value used as the "no element" link. */
+#define POOL_LIST_INVALID_INDEX (0xFFFFU)
+
+/*! @brief Maximum number of elements a pool list can manage. */
+#define POOL_LIST_MAX_ELEMENTS (0xFFFFU)
+
+/*! @brief Number of 32-bit words needed by each bitmap of a list with @p max elements. */
+#define POOL_LIST_BITMAP_WORDS(max) (((uint32_t)(max) + 31U) / 32U)
+
+/*!
+ * @brief Defines the static storage needed by a pool list.
+ *
+ * The macro declares the link array, the membership bitmap and the allocation bitmap.
+ * Pass the storage to POOL_LIST_Init() with POOL_LIST_NODES(), POOL_LIST_BITMAP() and
+ * POOL_LIST_ALLOCATED().
+ *
+ * @param name - Name of the list storage.
+ * @param max - Number of elements in the pool.
+ */
+#define POOL_LIST_DEFINE(name, max)                                    \
+    static pool_list_node_t s_##name##Nodes[(max)];                    \
+    static uint32_t s_##name##Bitmap[POOL_LIST_BITMAP_WORDS(max)];     \
+    static uint32_t s_##name##Allocated[POOL_LIST_BITMAP_WORDS(max)]
+
+/*! @brief Gets the link array declared by POOL_LIST_DEFINE(). */
+#define POOL_LIST_NODES(name) (&s_##name##Nodes[0])
+
+/*! @brief Gets the membership bitmap declared by POOL_LIST_DEFINE(). */
+#define POOL_LIST_BITMAP(name) (&s_##name##Bitmap[0])
+
+/*! @brief Gets the allocation bitmap declared by POOL_LIST_DEFINE(). */
+#define POOL_LIST_ALLOCATED(name) (&s_##name##Allocated[0])
+
+/**********************************************************************************
+ * Public type definitions
+ ***********************************************************************************/
+/*! @brief Element index inside the pool. */
+typedef uint16_t pool_list_index_t;
+
+/*! @brief The pool list link entry, one per element slot. */
+typedef struct _pool_list_node
+{
+    pool_list_index_t next; /*!< next element index */
+    pool_list_index_t prev; /*!< previous element index */
+} pool_list_node_t;
+
+/*! @brief The pool list structure */
+typedef struct pool_list_label
+{
+    pool_list_node_t *nodes;    /*!< link array, indexed like the user element array */
+    uint32_t *member;           /*!< membership bitmap, one bit per element */
+    uint32_t *allocated;        /*!< allocation bitmap, one bit per element slot */
+    pool_list_index_t head;     /*!< list head */
+    pool_list_index_t tail;     /*!< list tail */
+    pool_list_index_t freeHead; /*!< head of the free slot list */
+    uint16_t size;              /*!< list size */
+    uint16_t max;               /*!< list max number of elements */
+    uint16_t freeCount;         /*!< number of free element slots */
+} pool_list_label_t, *pool_list_handle_t;
+
+/**********************************************************************************
+ * API
+ **********************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+/*!
+ * @brief Initialize the pool list.
+ *
+ * All element slots are placed in the free list and no element is linked.
+ * The user keeps its own element array of @p max entries; the pool list only
+ * manages indexes into it.
+ *
+ * @param list - List handle to initialize.
+ * @param nodes - Link array of @p max entries.
+ * @param member - Membership bitmap of POOL_LIST_BITMAP_WORDS(max) words.
+ * @param allocated - Allocation bitmap of POOL_LIST_BITMAP_WORDS(max) words.
+ * @param max - Number of element slots, at most POOL_LIST_MAX_ELEMENTS - 1.
+ */
+void POOL_LIST_Init(
+    pool_list_handle_t list, pool_list_node_t *nodes, uint32_t *member, uint32_t *allocated, uint16_t max);
+
+/*!
+ * @brief Takes a free element slot from the pool.
+ *
+ * @param list - Handle of the list.
+ * @retval POOL_LIST_INVALID_INDEX if no slot is free, otherwise the slot index.
+ */
+pool_list_index_t POOL_LIST_Alloc(pool_list_handle_t list);
+
+/*!
+ * @brief Returns an element slot to the pool.
+ *
+ * @param list - Handle of the list.
+ * @param index - Index of the slot.
+ * @retval kLIST_OrphanElement if the slot is not allocated: freed twice or never allocated.
+ * @retval kLIST_DuplicateError if the element is still linked.
+ * @retval kLIST_Ok if the slot is back in the pool.
+ */
+list_status_t POOL_LIST_Free(pool_list_handle_t list, pool_list_index_t index);
+
+/*!
+ * @brief Checks whether an element is linked in the list.
+ *
+ * @param list - Handle of the list.
+ * @param index - Index of the element.
+ * @retval true if the element is linked, false otherwise.
+ */
+static inline bool POOL_LIST_IsMember(pool_list_handle_t list, pool_list_index_t index)
+{
+    return ((list->member[index >> 5U] & (1UL << (index & 0x1FU))) != 0U);
+}
+
+/*!
+ * @brief Checks whether an element slot is allocated.
+ *
+ * @param list - Handle of the list.
+ * @param index - Index of the slot.
+ * @retval true if the slot was taken with POOL_LIST_Alloc() and not freed, false otherwise.
+ */
+static inline bool POOL_LIST_IsAllocated(pool_list_handle_t list, pool_list_index_t index)
+{
+    return ((list->allocated[index >> 5U] & (1UL << (index & 0x1FU))) != 0U);
+}
+
+/*!
+ * @brief Links element to the head of the list.
+ *
+ * @param list - Handle of the list.
+ * @param index - Index of the element.
+ * @retval kLIST_OrphanElement if the slot is not allocated.
+ * @retval kLIST_DuplicateError if element is already linked.
+ * @retval kLIST_Ok if insertion was successful.
+ */
+list_status_t POOL_LIST_AddHead(pool_list_handle_t list, pool_list_index_t index);
+
+/*!
+ * @brief Links element to the tail of the list.
+ *
+ * @param list - Handle of the list.
+ * @param index - Index of the element.
+ * @retval kLIST_OrphanElement if the slot is not allocated.
+ * @retval kLIST_DuplicateError if element is already linked.
+ * @retval kLIST_Ok if insertion was successful.
+ */
+list_status_t POOL_LIST_AddTail(pool_list_handle_t list, pool_list_index_t index);
+
+/*!
+ * @brief Unlinks element from the head of the list.
+ *
+ * @param list - Handle of the list.
+ *
+ * @retval POOL_LIST_INVALID_INDEX if list is empty, index of removed element if removal was successful.
+ */
+pool_list_index_t POOL_LIST_RemoveHead(pool_list_handle_t list);
+
+/*!
+ * @brief Unlinks an element from the list.
+ *
+ * @param list - Handle of the list.
+ * @param index - Index of the element.
+ *
+ * @retval kLIST_OrphanElement if element is not part of the list.
+ * @retval kLIST_Ok if removal was successful.
+ */
+list_status_t POOL_LIST_RemoveElement(pool_list_handle_t list, pool_list_index_t index);
+
+/*!
+ * @brief Links an element in the previous position relative to a given member of the list.
+ *
+ * @param list - Handle of the list.
+ * @param index - Index of a member of the list.
+ * @param newIndex - Index of the new element to insert before the given member.
+ *
+ * @retval kLIST_OrphanElement if element is not part of the list or the new slot is not allocated.
+ * @retval kLIST_DuplicateError if the new element is already linked.
+ * @retval kLIST_Ok if insertion was successful.
+ */
+list_status_t POOL_LIST_AddPrevElement(pool_list_handle_t list, pool_list_index_t index, pool_list_index_t newIndex);
+
+/*!
+ * @brief Gets head element index.
+ *
+ * @param list - Handle of the list.
+ *
+ * @retval POOL_LIST_INVALID_INDEX if list is empty, index of head element otherwise.
+ */
+static inline pool_list_index_t POOL_LIST_GetHead(pool_list_handle_t list)
+{
+    return list->head;
+}
+
+/*!
+ * @brief Gets next element index for given element index.
+ *
+ * @param list - Handle of the list.
+ * @param index - Index of the element.
+ *
+ * @retval POOL_LIST_INVALID_INDEX if element is tail, index of next element otherwise.
+ */
+static inline pool_list_index_t POOL_LIST_GetNext(pool_list_handle_t list, pool_list_index_t index)
+{
+    return list->nodes[index].next;
+}
+
+/*!
+ * @brief Gets previous element index for given element index.
+ *
+ * @param list - Handle of the list.
+ * @param index - Index of the element.
+ *
+ * @retval POOL_LIST_INVALID_INDEX if element is head, index of previous element otherwise.
+ */
+static inline pool_list_index_t POOL_LIST_GetPrev(pool_list_handle_t list, pool_list_index_t index)
+{
+    return list->nodes[index].prev;
+}
+
+/*!
+ * @brief Gets the current size of a list.
+ *
+ * @param list - Handle of the list.
+ *
+ * @retval Current size of the list.
+ */
+static inline uint32_t POOL_LIST_GetSize(pool_list_handle_t list)
+{
+    return list->size;
+}
+
+/*!
+ * @brief Gets the number of free element slots in the pool.
+ *
+ * @param list - Handle of the list.
+ *
+ * @retval Number of slots POOL_LIST_Alloc() can still return.
+ */
+static inline uint32_t POOL_LIST_GetAvailableSize(pool_list_handle_t list)
+{
+    return list->freeCount;
+}
+
+/* @} */
+
+#if defined(__cplusplus)
+}
+#endif
+/*! @}*/
+#endif /*_POOL_LIST_H_*/
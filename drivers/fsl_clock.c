@@ -14,14 +14,110 @@
 #define FSL_COMPONENT_ID "platform.drivers.clock"
 #endif
 
+/* Reference counted gates: MRCC_GLB_CC0, MRCC_GLB_CC1, then the FlexPWM submodules. */
+#define CLOCK_GATE_MRCC_REGS (2U)
+#define CLOCK_GATE_ROWS      (CLOCK_GATE_MRCC_REGS + 1U)
+#define CLOCK_GATE_ROW_PWMSM (CLOCK_GATE_MRCC_REGS)
+/* MRCC_GLB_CC1 gates of the flash, RAM and ROM controllers, never closed by CLOCK_GateUnownedClocks(). */
+#define CLOCK_GATE_SYSTEM_MASK1                                                                   \
+    ((1UL << CLK_GATE_BIT_SHIFT(kCLOCK_GateMTR)) | (1UL << CLK_GATE_BIT_SHIFT(kCLOCK_GateTCU)) | \
+     (1UL << CLK_GATE_BIT_SHIFT(kCLOCK_GateEZRAMC_RAMA)) | (1UL << CLK_GATE_BIT_SHIFT(kCLOCK_GateROMCP)))
+
+/* Clock tree sources, by selection value. Oscillator masks plus the two derived sources below. */
+#define CLOCK_SRC_NONE     (0U)
+#define CLOCK_SRC_FIRC     ((uint8_t)kCLOCK_OscFroHf)
+#define CLOCK_SRC_SIRC     ((uint8_t)kCLOCK_OscFro12M)
+#define CLOCK_SRC_1M       ((uint8_t)kCLOCK_OscFro12M)
+#define CLOCK_SRC_16K      ((uint8_t)kCLOCK_OscFro16K)
+#define CLOCK_SRC_IN       ((uint8_t)kCLOCK_OscExt)
+#define CLOCK_SRC_FIRC_DIV (0x40U | CLOCK_SRC_FIRC) /* Through the FRO_HF_DIV divider. */
+#define CLOCK_SRC_CPU      (0x80U)                  /* CPU_CLK or SLOW_CLK, follows the main clock. */
+#define CLOCK_SRC_OSC_MASK (0x0FU)
+/* Consumer without divider or selection mux. */
+#define CLOCK_TREE_NONE    (0U)
+
+#if (defined(FSL_CLOCK_FREQ_CACHE) && (FSL_CLOCK_FREQ_CACHE > 0U))
+/* Frequency cache slots: one per clock_name_t, then the getters called on their own. */
+#define CLOCK_FREQ_CACHE_MAIN_CLK   (14U)
+#define CLOCK_FREQ_CACHE_CORE_CLK   (15U)
+#define CLOCK_FREQ_CACHE_LPUART(id) (16U + (id))
+#define CLOCK_FREQ_CACHE_SLOTS      (19U)
+#endif
+
+/* Peripheral functional clock in the clock tree. */
+typedef struct _clock_tree_consumer
+{
+    uint16_t sel;         /* clock_select_name_t, or CLOCK_TREE_NONE for a fixed source. */
+    uint16_t div;         /* clock_div_name_t, or CLOCK_TREE_NONE. */
+    clock_ip_name_t gate; /* MRCC gate, kCLOCK_GateNotAvail if always clocked. */
+    uint8_t src[8];       /* Source of each selection value. */
+} clock_tree_consumer_t;
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
+/* Main clock sources, by SCG RCCR[SCS] value. */
+static const uint8_t s_clockMainClkSrc[8] = {CLOCK_SRC_NONE, CLOCK_SRC_IN,  CLOCK_SRC_SIRC, CLOCK_SRC_FIRC,
+                                             CLOCK_SRC_16K,  CLOCK_SRC_NONE, CLOCK_SRC_NONE, CLOCK_SRC_NONE};
+
+/* Functional clocks of the MRCC, sources as listed in clock_attach_id_t. */
+static const clock_tree_consumer_t s_clockTreeConsumers[] = {
+    {kCLOCK_SelI3C0_FCLK, kCLOCK_DivI3C0_FCLK, kCLOCK_GateI3C0,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_NONE, CLOCK_SRC_FIRC_DIV, CLOCK_SRC_IN, CLOCK_SRC_NONE, CLOCK_SRC_1M}},
+    {kCLOCK_SelCTIMER0, kCLOCK_DivCTIMER0, kCLOCK_GateCTIMER0,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_FIRC, CLOCK_SRC_NONE, CLOCK_SRC_IN, CLOCK_SRC_16K, CLOCK_SRC_1M}},
+    {kCLOCK_SelCTIMER1, kCLOCK_DivCTIMER1, kCLOCK_GateCTIMER1,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_FIRC, CLOCK_SRC_NONE, CLOCK_SRC_IN, CLOCK_SRC_16K, CLOCK_SRC_1M}},
+    {kCLOCK_SelCTIMER2, kCLOCK_DivCTIMER2, kCLOCK_GateCTIMER2,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_FIRC, CLOCK_SRC_NONE, CLOCK_SRC_IN, CLOCK_SRC_16K, CLOCK_SRC_1M}},
+    {CLOCK_TREE_NONE, kCLOCK_DivWWDT0, kCLOCK_GateWWDT0, {CLOCK_SRC_1M}},
+    {kCLOCK_SelLPI2C0, kCLOCK_DivLPI2C0, kCLOCK_GateLPI2C0,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_NONE, CLOCK_SRC_FIRC_DIV, CLOCK_SRC_IN, CLOCK_SRC_NONE, CLOCK_SRC_1M}},
+    {kCLOCK_SelLPSPI0, kCLOCK_DivLPSPI0, kCLOCK_GateLPSPI0,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_NONE, CLOCK_SRC_FIRC_DIV, CLOCK_SRC_IN, CLOCK_SRC_NONE, CLOCK_SRC_1M}},
+    {kCLOCK_SelLPSPI1, kCLOCK_DivLPSPI1, kCLOCK_GateLPSPI1,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_NONE, CLOCK_SRC_FIRC_DIV, CLOCK_SRC_IN, CLOCK_SRC_NONE, CLOCK_SRC_1M}},
+    {kCLOCK_SelLPUART0, kCLOCK_DivLPUART0, kCLOCK_GateLPUART0,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_NONE, CLOCK_SRC_FIRC_DIV, CLOCK_SRC_IN, CLOCK_SRC_16K, CLOCK_SRC_1M}},
+    {kCLOCK_SelLPUART1, kCLOCK_DivLPUART1, kCLOCK_GateLPUART1,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_NONE, CLOCK_SRC_FIRC_DIV, CLOCK_SRC_IN, CLOCK_SRC_16K, CLOCK_SRC_1M}},
+    {kCLOCK_SelLPUART2, kCLOCK_DivLPUART2, kCLOCK_GateLPUART2,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_NONE, CLOCK_SRC_FIRC_DIV, CLOCK_SRC_IN, CLOCK_SRC_16K, CLOCK_SRC_1M}},
+    {kCLOCK_SelUSB0, CLOCK_TREE_NONE, kCLOCK_GateUSB0, {CLOCK_SRC_NONE, CLOCK_SRC_FIRC, CLOCK_SRC_IN}},
+    {kCLOCK_SelLPTMR0, kCLOCK_DivLPTMR0, kCLOCK_GateNotAvail,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_NONE, CLOCK_SRC_FIRC_DIV, CLOCK_SRC_IN, CLOCK_SRC_NONE, CLOCK_SRC_1M}},
+    {kCLOCK_SelOSTIMER0, CLOCK_TREE_NONE, kCLOCK_GateOSTIMER0, {CLOCK_SRC_16K, CLOCK_SRC_NONE, CLOCK_SRC_1M}},
+    {kCLOCK_SelADC0, kCLOCK_DivADC0, kCLOCK_GateADC0,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_FIRC, CLOCK_SRC_NONE, CLOCK_SRC_IN, CLOCK_SRC_NONE, CLOCK_SRC_1M}},
+    {kCLOCK_SelCMP0_RR, kCLOCK_DivCMP0_RR, kCLOCK_GateCMP0,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_NONE, CLOCK_SRC_FIRC_DIV, CLOCK_SRC_IN, CLOCK_SRC_NONE, CLOCK_SRC_1M}},
+    {kCLOCK_SelCMP1_RR, kCLOCK_DivCMP1_RR, kCLOCK_GateCMP1,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_NONE, CLOCK_SRC_FIRC_DIV, CLOCK_SRC_IN, CLOCK_SRC_NONE, CLOCK_SRC_1M}},
+    {kCLOCK_SelTRACE, kCLOCK_DivTRACE, kCLOCK_GateNotAvail, {CLOCK_SRC_CPU, CLOCK_SRC_1M, CLOCK_SRC_16K}},
+    {kCLOCK_SelCLKOUT, kCLOCK_DivCLKOUT, kCLOCK_GateNotAvail,
+     {CLOCK_SRC_SIRC, CLOCK_SRC_FIRC_DIV, CLOCK_SRC_IN, CLOCK_SRC_16K, CLOCK_SRC_NONE, CLOCK_SRC_NONE,
+      CLOCK_SRC_CPU}},
+    {kCLOCK_SelSYSTICK, kCLOCK_DivSYSTICK, kCLOCK_GateNotAvail, {CLOCK_SRC_CPU, CLOCK_SRC_1M, CLOCK_SRC_16K}},
+};
+
 /** External clock rate on the CLKIN pin in Hz. If not used,
     set this to 0. Otherwise, set it to the exact rate in Hz this pin is
     being driven at. */
 volatile static uint32_t s_Ext_Clk_Freq = 16000000U;
 
+/* CLOCK_RequestClock() references per gate. */
+static uint8_t s_clockGateRefCount[CLOCK_GATE_ROWS][32];
+/* Gates that were already enabled when first requested, not gated by the last release. */
+static uint32_t s_clockGateKeepOpen[CLOCK_GATE_ROWS];
+
+#if (defined(FSL_CLOCK_FREQ_CACHE) && (FSL_CLOCK_FREQ_CACHE > 0U))
+static uint32_t s_clockFreqCache[CLOCK_FREQ_CACHE_SLOTS];
+/* Bit n set when s_clockFreqCache[n] is valid. */
+static volatile uint32_t s_clockFreqCacheValid;
+/* Incremented by every invalidation, a frequency computed across a change is not cached. */
+static volatile uint32_t s_clockFreqCacheGeneration;
+#endif
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -41,11 +137,230 @@ static uint32_t CLOCK_GetExtClkFreq(void);
 uint32_t CLOCK_GetMainClk(void);
 /* Get FRO_16K */
 static uint32_t CLOCK_GetFRO16KFreq(void);
+/* Get the reference count row of a gate */
+static uint32_t CLOCK_GetGateRow(clock_ip_name_t clk);
+/* Resolve a clock tree source to oscillators */
+static uint32_t CLOCK_GetSourceOscillators(uint8_t src, bool mainClkRunning);
+/* Get the oscillators feeding a functional clock */
+static uint32_t CLOCK_GetConsumerOscillators(const clock_tree_consumer_t *consumer, bool mainClkRunning);
+#if (defined(FSL_CLOCK_FREQ_CACHE) && (FSL_CLOCK_FREQ_CACHE > 0U))
+/* Store a computed frequency */
+static void CLOCK_CacheFreq(uint32_t slot, uint32_t generation, uint32_t freq);
+#endif
 
 /*******************************************************************************
  * Code
  ******************************************************************************/
 
+static uint32_t CLOCK_GetGateRow(clock_ip_name_t clk)
+{
+    uint32_t reg_offset = CLK_GATE_REG_OFFSET(clk);
+
+    return (reg_offset == REG_PWM0SUBCTL) ? CLOCK_GATE_ROW_PWMSM : (reg_offset / 0x10U);
+}
+
+/**
+ * brief Take a reference on the clock for specific IP.
+ * param clk : Clock to be referenced.
+ * return  Nothing
+ */
+void CLOCK_RequestClock(clock_ip_name_t clk)
+{
+    uint32_t row = CLOCK_GetGateRow(clk);
+    uint32_t bit = CLK_GATE_BIT_SHIFT(clk);
+    uint32_t primask;
+
+    if (clk == kCLOCK_GateNotAvail)
+    {
+        return;
+    }
+
+    assert((row < CLOCK_GATE_ROWS) && (bit < 32U));
+
+    primask = DisableGlobalIRQ();
+    assert(s_clockGateRefCount[row][bit] < UINT8_MAX);
+    if (0U == s_clockGateRefCount[row][bit]++)
+    {
+        if (CLOCK_IsClockEnabled(clk))
+        {
+            s_clockGateKeepOpen[row] |= (1UL << bit);
+        }
+        else
+        {
+            s_clockGateKeepOpen[row] &= ~(1UL << bit);
+            CLOCK_EnableClock(clk);
+        }
+    }
+    EnableGlobalIRQ(primask);
+}
+
+/**
+ * brief Release a reference taken by CLOCK_RequestClock().
+ * param clk : Clock to be released.
+ * return  Nothing
+ */
+void CLOCK_ReleaseClock(clock_ip_name_t clk)
+{
+    uint32_t row = CLOCK_GetGateRow(clk);
+    uint32_t bit = CLK_GATE_BIT_SHIFT(clk);
+    uint32_t primask;
+
+    if (clk == kCLOCK_GateNotAvail)
+    {
+        return;
+    }
+
+    assert((row < CLOCK_GATE_ROWS) && (bit < 32U));
+
+    primask = DisableGlobalIRQ();
+    assert(s_clockGateRefCount[row][bit] != 0U);
+    if ((0U == --s_clockGateRefCount[row][bit]) && (0U == (s_clockGateKeepOpen[row] & (1UL << bit))))
+    {
+        CLOCK_DisableClock(clk);
+    }
+    EnableGlobalIRQ(primask);
+}
+
+/**
+ * brief Get the number of references on the clock for specific IP.
+ * param clk : Clock to be checked.
+ * return  Number of CLOCK_RequestClock() references.
+ */
+uint32_t CLOCK_GetClockRefCount(clock_ip_name_t clk)
+{
+    uint32_t row = CLOCK_GetGateRow(clk);
+    uint32_t bit = CLK_GATE_BIT_SHIFT(clk);
+
+    if ((clk == kCLOCK_GateNotAvail) || (row >= CLOCK_GATE_ROWS) || (bit >= 32U))
+    {
+        return 0U;
+    }
+
+    return s_clockGateRefCount[row][bit];
+}
+
+/**
+ * brief Report the MRCC clock gates left open.
+ * param audit : Open and unowned gates.
+ * return  Number of open gates without reference.
+ */
+uint32_t CLOCK_GetClockGateAudit(clock_gate_audit_t *audit)
+{
+    uint32_t count = 0U;
+    uint32_t unowned;
+    uint32_t row;
+    uint32_t bit;
+
+    assert(audit != NULL);
+
+    audit->open[0] = MRCC0->MRCC_GLB_CC0;
+    audit->open[1] = MRCC0->MRCC_GLB_CC1;
+
+    for (row = 0U; row < CLOCK_GATE_MRCC_REGS; row++)
+    {
+        unowned = audit->open[row];
+        for (bit = 0U; bit < 32U; bit++)
+        {
+            if (s_clockGateRefCount[row][bit] != 0U)
+            {
+                unowned &= ~(1UL << bit);
+            }
+        }
+        audit->unowned[row] = unowned;
+
+        while (unowned != 0U)
+        {
+            unowned &= unowned - 1U;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * brief Gate the MRCC clock gates left open without reference.
+ * param audit : Gates to close, from CLOCK_GetClockGateAudit(); on return the gates actually closed.
+ * return  Nothing
+ */
+void CLOCK_GateUnownedClocks(clock_gate_audit_t *audit)
+{
+    uint32_t primask;
+    uint32_t row;
+    uint32_t bit;
+
+    assert(audit != NULL);
+
+    primask = DisableGlobalIRQ();
+    /* Check the gates again, a gate closed or requested since the audit is left alone. */
+    audit->unowned[0] &= MRCC0->MRCC_GLB_CC0;
+    audit->unowned[1] &= MRCC0->MRCC_GLB_CC1;
+    for (row = 0U; row < CLOCK_GATE_MRCC_REGS; row++)
+    {
+        for (bit = 0U; bit < 32U; bit++)
+        {
+            if (s_clockGateRefCount[row][bit] != 0U)
+            {
+                audit->unowned[row] &= ~(1UL << bit);
+            }
+        }
+    }
+    audit->unowned[1] &= ~CLOCK_GATE_SYSTEM_MASK1;
+    /* FLEXPWM0 is opened by the PWM submodule gates, which have their own references. */
+    if (0U != (SYSCON->PWM0SUBCTL & 0xFU))
+    {
+        audit->unowned[0] &= ~(1UL << CLK_GATE_BIT_SHIFT(kCLOCK_GateFLEXPWM0));
+    }
+
+    SYSCON->CLKUNLOCK &= ~SYSCON_CLKUNLOCK_UNLOCK_MASK;
+    MRCC0->MRCC_GLB_CC0_CLR = audit->unowned[0];
+    MRCC0->MRCC_GLB_CC1_CLR = audit->unowned[1];
+    SYSCON->CLKUNLOCK |= SYSCON_CLKUNLOCK_UNLOCK_MASK;
+    EnableGlobalIRQ(primask);
+}
+
+/**
+ * brief Reopen the clock gates closed by CLOCK_GateUnownedClocks().
+ * param audit : Gates closed by CLOCK_GateUnownedClocks().
+ * return  Nothing
+ */
+void CLOCK_UngateClocks(const clock_gate_audit_t *audit)
+{
+    assert(audit != NULL);
+
+    SYSCON->CLKUNLOCK &= ~SYSCON_CLKUNLOCK_UNLOCK_MASK;
+    MRCC0->MRCC_GLB_CC0_SET = audit->unowned[0];
+    MRCC0->MRCC_GLB_CC1_SET = audit->unowned[1];
+    SYSCON->CLKUNLOCK |= SYSCON_CLKUNLOCK_UNLOCK_MASK;
+}
+
+#if (defined(FSL_CLOCK_FREQ_CACHE) && (FSL_CLOCK_FREQ_CACHE > 0U))
+static void CLOCK_CacheFreq(uint32_t slot, uint32_t generation, uint32_t freq)
+{
+    uint32_t primask = DisableGlobalIRQ();
+
+    if ((slot < CLOCK_FREQ_CACHE_SLOTS) && (generation == s_clockFreqCacheGeneration))
+    {
+        s_clockFreqCache[slot] = freq;
+        s_clockFreqCacheValid |= (1UL << slot);
+    }
+    EnableGlobalIRQ(primask);
+}
+#endif
+
+/*! brief  Invalidate the cached clock frequencies
+ */
+void CLOCK_InvalidateFreqCache(void)
+{
+#if (defined(FSL_CLOCK_FREQ_CACHE) && (FSL_CLOCK_FREQ_CACHE > 0U))
+    uint32_t primask = DisableGlobalIRQ();
+
+    s_clockFreqCacheValid = 0U;
+    s_clockFreqCacheGeneration++;
+    EnableGlobalIRQ(primask);
+#endif
+}
+
 /* Clock Selection for IP */
 /**
  * brief   Configure the clock selection muxes.
@@ -109,6 +424,8 @@ void CLOCK_SetClockSelect(clock_select_name_t sel_name, uint32_t value)
         /* Freeze clock configuration */
         SYSCON->CLKUNLOCK |= SYSCON_CLKUNLOCK_UNLOCK_MASK;
     }
+
+    CLOCK_InvalidateFreqCache();
 }
 
 /* Get the clock selection value */
@@ -153,6 +470,8 @@ void CLOCK_SetClockDiv(clock_div_name_t div_name, uint32_t value)
 
     /* Freeze clock configuration */
     SYSCON->CLKUNLOCK |= SYSCON_CLKUNLOCK_UNLOCK_MASK;
+
+    CLOCK_InvalidateFreqCache();
 }
 
 /* Get the clock divider value */
@@ -184,6 +503,8 @@ void CLOCK_HaltClockDiv(clock_div_name_t div_name)
 
     /* Freeze clock configuration */
     SYSCON->CLKUNLOCK |= SYSCON_CLKUNLOCK_UNLOCK_MASK;
+
+    CLOCK_InvalidateFreqCache();
 }
 
 /* Initialize the FROHF to given frequency (48,64,96,192) */
@@ -230,6 +551,30 @@ status_t CLOCK_SetupFROHFClocking(uint32_t iFreq)
     {
     }
 
+    CLOCK_InvalidateFreqCache();
+
+    return kStatus_Success;
+}
+
+/* Stop the FROHF when nothing depends on it. */
+status_t CLOCK_StopFROHFClocking(void)
+{
+    if (0U != (CLOCK_GetRequiredOscillators(true) & (uint32_t)kCLOCK_OscFroHf))
+    {
+        return kStatus_Busy;
+    }
+
+    /* Unlock FIRCCSR */
+    SCG0->FIRCCSR &= ~SCG_FIRCCSR_LK_MASK;
+
+    /* Disable FIRC */
+    SCG0->FIRCCSR &= ~SCG_FIRCCSR_FIRCEN_MASK;
+
+    /* Lock FIRCCSR */
+    SCG0->FIRCCSR |= SCG_FIRCCSR_LK_MASK;
+
+    CLOCK_InvalidateFreqCache();
+
     return kStatus_Success;
 }
 
@@ -250,6 +595,8 @@ status_t CLOCK_SetupFRO12MClocking(void)
     {
     }
 
+    CLOCK_InvalidateFreqCache();
+
     return kStatus_Success;
 }
 
@@ -266,6 +613,8 @@ status_t CLOCK_SetupFRO16KClocking(uint8_t clk_16k_enable_mask)
     /* enable clk_16k0 and clk_16k1. */
     VBAT0->FROCLKE = VBAT_FROCLKE_CLKE((clk_16k_enable_mask)&VBAT_FROCLKE_CLKE_MASK);
 
+    CLOCK_InvalidateFreqCache();
+
     return kStatus_Success;
 }
 
@@ -324,6 +673,8 @@ status_t CLOCK_SetupExtClocking(uint32_t iFreq)
 
     s_Ext_Clk_Freq = iFreq;
 
+    CLOCK_InvalidateFreqCache();
+
     return kStatus_Success;
 }
 
@@ -334,6 +685,15 @@ status_t CLOCK_SetupExtClocking(uint32_t iFreq)
 uint32_t CLOCK_GetFreq(clock_name_t clockName)
 {
     uint32_t freq = 0U;
+#if (defined(FSL_CLOCK_FREQ_CACHE) && (FSL_CLOCK_FREQ_CACHE > 0U))
+    uint32_t generation = s_clockFreqCacheGeneration;
+
+    if (((uint32_t)clockName < CLOCK_FREQ_CACHE_MAIN_CLK) &&
+        (0U != (s_clockFreqCacheValid & (1UL << (uint32_t)clockName))))
+    {
+        return s_clockFreqCache[(uint32_t)clockName];
+    }
+#endif
 
     switch (clockName)
     {
@@ -383,6 +743,9 @@ uint32_t CLOCK_GetFreq(clock_name_t clockName)
             freq = 0U;
             break;
     }
+#if (defined(FSL_CLOCK_FREQ_CACHE) && (FSL_CLOCK_FREQ_CACHE > 0U))
+    CLOCK_CacheFreq((uint32_t)clockName, generation, freq);
+#endif
     return freq;
 }
 
@@ -499,6 +862,14 @@ static uint32_t CLOCK_GetExtClkFreq(void)
 uint32_t CLOCK_GetMainClk(void)
 {
     uint32_t freq = 0U;
+#if (defined(FSL_CLOCK_FREQ_CACHE) && (FSL_CLOCK_FREQ_CACHE > 0U))
+    uint32_t generation = s_clockFreqCacheGeneration;
+
+    if (0U != (s_clockFreqCacheValid & (1UL << CLOCK_FREQ_CACHE_MAIN_CLK)))
+    {
+        return s_clockFreqCache[CLOCK_FREQ_CACHE_MAIN_CLK];
+    }
+#endif
 
     switch ((SCG0->CSR & SCG_CSR_SCS_MASK) >> SCG_CSR_SCS_SHIFT)
     {
@@ -519,6 +890,10 @@ uint32_t CLOCK_GetMainClk(void)
             break;
     }
 
+#if (defined(FSL_CLOCK_FREQ_CACHE) && (FSL_CLOCK_FREQ_CACHE > 0U))
+    CLOCK_CacheFreq(CLOCK_FREQ_CACHE_MAIN_CLK, generation, freq);
+#endif
+
     return freq;
 }
 
@@ -527,7 +902,23 @@ uint32_t CLOCK_GetMainClk(void)
  */
 uint32_t CLOCK_GetCoreSysClkFreq(void)
 {
-    return CLOCK_GetMainClk() / ((SYSCON->AHBCLKDIV & 0xffU) + 1U);
+    uint32_t freq;
+#if (defined(FSL_CLOCK_FREQ_CACHE) && (FSL_CLOCK_FREQ_CACHE > 0U))
+    uint32_t generation = s_clockFreqCacheGeneration;
+
+    if (0U != (s_clockFreqCacheValid & (1UL << CLOCK_FREQ_CACHE_CORE_CLK)))
+    {
+        return s_clockFreqCache[CLOCK_FREQ_CACHE_CORE_CLK];
+    }
+#endif
+
+    freq = CLOCK_GetMainClk() / ((SYSCON->AHBCLKDIV & 0xffU) + 1U);
+
+#if (defined(FSL_CLOCK_FREQ_CACHE) && (FSL_CLOCK_FREQ_CACHE > 0U))
+    CLOCK_CacheFreq(CLOCK_FREQ_CACHE_CORE_CLK, generation, freq);
+#endif
+
+    return freq;
 }
 
 /* Get LPI2C Clk */
@@ -687,11 +1078,23 @@ uint32_t CLOCK_GetLpspiClkFreq(uint32_t id)
  */
 uint32_t CLOCK_GetLpuartClkFreq(uint32_t id)
 {
-    uint32_t freq   = 0U;
-    uint32_t clksel = (0 == id) ? (MRCC0->MRCC_LPUART0_CLKSEL) :
-                                  (((1 == id)) ? (MRCC0->MRCC_LPUART1_CLKSEL) : (MRCC0->MRCC_LPUART2_CLKSEL));
-    uint32_t clkdiv = (0 == id) ? (MRCC0->MRCC_LPUART0_CLKDIV) :
-                                  (((1 == id)) ? (MRCC0->MRCC_LPUART1_CLKDIV) : (MRCC0->MRCC_LPUART2_CLKDIV));
+    uint32_t freq = 0U;
+    uint32_t clksel;
+    uint32_t clkdiv;
+#if (defined(FSL_CLOCK_FREQ_CACHE) && (FSL_CLOCK_FREQ_CACHE > 0U))
+    uint32_t generation = s_clockFreqCacheGeneration;
+
+    assert(id < 3U);
+    if (0U != (s_clockFreqCacheValid & (1UL << CLOCK_FREQ_CACHE_LPUART(id))))
+    {
+        return s_clockFreqCache[CLOCK_FREQ_CACHE_LPUART(id)];
+    }
+#endif
+
+    clksel = (0 == id) ? (MRCC0->MRCC_LPUART0_CLKSEL) :
+                         (((1 == id)) ? (MRCC0->MRCC_LPUART1_CLKSEL) : (MRCC0->MRCC_LPUART2_CLKSEL));
+    clkdiv = (0 == id) ? (MRCC0->MRCC_LPUART0_CLKDIV) :
+                         (((1 == id)) ? (MRCC0->MRCC_LPUART1_CLKDIV) : (MRCC0->MRCC_LPUART2_CLKDIV));
 
     if ((clkdiv & (1 << 30)) != 0)
     {
@@ -719,8 +1122,13 @@ uint32_t CLOCK_GetLpuartClkFreq(uint32_t id)
             freq = 0U;
             break;
     }
+    freq /= ((clkdiv & 0xffU) + 1U);
 
-    return freq / ((clkdiv & 0xffU) + 1U);
+#if (defined(FSL_CLOCK_FREQ_CACHE) && (FSL_CLOCK_FREQ_CACHE > 0U))
+    CLOCK_CacheFreq(CLOCK_FREQ_CACHE_LPUART(id), generation, freq);
+#endif
+
+    return freq;
 }
 
 /*! brief  Return Frequency of LPTMR functional Clock
@@ -1021,15 +1429,27 @@ uint32_t CLOCK_GetWwdtClkFreq(void)
  */
 status_t CLOCK_FROHFTrimConfig(firc_trim_config_t config)
 {
+    uint32_t csr;
+
     SCG0->FIRCTCFG = SCG_FIRCTCFG_TRIMDIV(config.trimDiv) | SCG_FIRCTCFG_TRIMSRC(config.trimSrc);
 
     if (kSCG_FircTrimNonUpdate == config.trimMode)
     {
-        SCG0->FIRCSTAT = SCG_FIRCSTAT_TRIMFINE(config.trimFine);
+        SCG0->FIRCSTAT = SCG_FIRCSTAT_TRIMCOAR(config.trimCoar) | SCG_FIRCSTAT_TRIMFINE(config.trimFine);
     }
 
-    /* Set trim mode. */
-    SCG0->FIRCCSR = (uint32_t)config.trimMode;
+    /* Unlock FIRCCSR */
+    SCG0->FIRCCSR &= ~SCG_FIRCCSR_LK_MASK;
+
+    /* Set trim mode, FIRC keeps running. FIRCERR and FIRCACC are write 1 to clear, don't write them back. */
+    csr = SCG0->FIRCCSR & ~(SCG_FIRCCSR_FIRCTREN_MASK | SCG_FIRCCSR_FIRCTRUP_MASK | SCG_FIRCCSR_FIRCERR_MASK |
+                            SCG_FIRCCSR_FIRCACC_MASK);
+    SCG0->FIRCCSR = csr | (uint32_t)config.trimMode;
+
+    /* Lock FIRCCSR */
+    SCG0->FIRCCSR |= SCG_FIRCCSR_LK_MASK;
+
+    CLOCK_InvalidateFreqCache();
 
     if ((SCG0->FIRCCSR & SCG_FIRCCSR_FIRCERR_MASK) == SCG_FIRCCSR_FIRCERR_MASK)
     {
@@ -1046,16 +1466,26 @@ status_t CLOCK_FROHFTrimConfig(firc_trim_config_t config)
  */
 status_t CLOCK_FRO12MTrimConfig(sirc_trim_config_t config)
 {
+    uint32_t csr;
+
     SCG0->SIRCTCFG = SCG_SIRCTCFG_TRIMDIV(config.trimDiv) | SCG_SIRCTCFG_TRIMSRC(config.trimSrc);
 
     if (kSCG_SircTrimNonUpdate == config.trimMode)
     {
-        SCG0->SIRCSTAT = SCG_SIRCSTAT_CCOTRIM(config.cltrim);
-        SCG0->SIRCSTAT = SCG_SIRCSTAT_CCOTRIM(config.ccotrim);
+        SCG0->SIRCSTAT = SCG_SIRCSTAT_CLTRIM(config.cltrim) | SCG_SIRCSTAT_CCOTRIM(config.ccotrim);
     }
 
-    /* Set trim mode. */
-    SCG0->SIRCCSR = (uint32_t)config.trimMode;
+    /* Unlock SIRCCSR */
+    SCG0->SIRCCSR &= ~SCG_SIRCCSR_LK_MASK;
+
+    /* Set trim mode, SIRC keeps running. SIRCERR is write 1 to clear, don't write it back. */
+    csr = SCG0->SIRCCSR & ~(SCG_SIRCCSR_SIRCTREN_MASK | SCG_SIRCCSR_SIRCTRUP_MASK | SCG_SIRCCSR_SIRCERR_MASK);
+    SCG0->SIRCCSR = csr | (uint32_t)config.trimMode;
+
+    /* Lock SIRCCSR */
+    SCG0->SIRCCSR |= SCG_SIRCCSR_LK_MASK;
+
+    CLOCK_InvalidateFreqCache();
 
     if ((SCG0->SIRCCSR & SCG_SIRCCSR_SIRCERR_MASK) == SCG_SIRCCSR_SIRCERR_MASK)
     {
@@ -1065,6 +1495,37 @@ status_t CLOCK_FRO12MTrimConfig(sirc_trim_config_t config)
     return (status_t)kStatus_Success;
 }
 
+/**
+ * @brief   Get the FROHF trim in use.
+ * @param   trimCoar : Coarse trim value
+ * @param   trimFine : Fine trim value
+ */
+void CLOCK_GetFROHFTrim(uint8_t *trimCoar, uint8_t *trimFine)
+{
+    /* FIRCSTAT holds the trim once trimming is enabled, FIRCTRIM the factory trim loaded at reset. */
+    uint32_t trim = ((SCG0->FIRCCSR & SCG_FIRCCSR_FIRCTREN_MASK) != 0U) ? SCG0->FIRCSTAT : SCG0->FIRCTRIM;
+
+    assert((trimCoar != NULL) && (trimFine != NULL));
+
+    *trimCoar = (uint8_t)((trim & SCG_FIRCSTAT_TRIMCOAR_MASK) >> SCG_FIRCSTAT_TRIMCOAR_SHIFT);
+    *trimFine = (uint8_t)((trim & SCG_FIRCSTAT_TRIMFINE_MASK) >> SCG_FIRCSTAT_TRIMFINE_SHIFT);
+}
+
+/**
+ * @brief   Get the FRO 12M trim in use.
+ * @param   cltrim   : Coarse trim value
+ * @param   ccotrim  : Fine trim value
+ */
+void CLOCK_GetFRO12MTrim(uint8_t *cltrim, uint8_t *ccotrim)
+{
+    uint32_t trim = SCG0->SIRCSTAT;
+
+    assert((cltrim != NULL) && (ccotrim != NULL));
+
+    *cltrim  = (uint8_t)((trim & SCG_SIRCSTAT_CLTRIM_MASK) >> SCG_SIRCSTAT_CLTRIM_SHIFT);
+    *ccotrim = (uint8_t)((trim & SCG_SIRCSTAT_CCOTRIM_MASK) >> SCG_SIRCSTAT_CCOTRIM_SHIFT);
+}
+
 /*!
  * @brief Sets the system OSC monitor mode.
  *
@@ -1084,6 +1545,142 @@ void CLOCK_SetSysOscMonitorMode(scg_sosc_monitor_mode_t mode)
     SCG0->SOSCCSR = reg;
 }
 
+static uint32_t CLOCK_GetSourceOscillators(uint8_t src, bool mainClkRunning)
+{
+    if (src == CLOCK_SRC_CPU)
+    {
+        return mainClkRunning ? CLOCK_GetSelectOscillators(kCLOCK_SelSCGSCS) : 0U;
+    }
+
+    if ((src == CLOCK_SRC_FIRC_DIV) && (CLOCK_GetClockDiv(kCLOCK_DivFRO_HF_DIV) == 0U))
+    {
+        return 0U;
+    }
+
+    return (uint32_t)src & CLOCK_SRC_OSC_MASK;
+}
+
+static uint32_t CLOCK_GetConsumerOscillators(const clock_tree_consumer_t *consumer, bool mainClkRunning)
+{
+    uint32_t sel = 0U;
+
+    if ((consumer->div != CLOCK_TREE_NONE) && (CLOCK_GetClockDiv((clock_div_name_t)consumer->div) == 0U))
+    {
+        return 0U;
+    }
+
+    if (consumer->sel != CLOCK_TREE_NONE)
+    {
+        sel = CLOCK_GetClockSelect((clock_select_name_t)consumer->sel);
+    }
+
+    return (sel < ARRAY_SIZE(consumer->src)) ? CLOCK_GetSourceOscillators(consumer->src[sel], mainClkRunning) : 0U;
+}
+
+/*!
+ * brief Get the oscillators currently feeding a clock selection mux.
+ * param sel_name Clock selection, kCLOCK_SelSCGSCS for the main clock.
+ * return Mask of clock_oscillator_t.
+ */
+uint32_t CLOCK_GetSelectOscillators(clock_select_name_t sel_name)
+{
+    uint32_t i;
+
+    if (sel_name == kCLOCK_SelSCGSCS)
+    {
+        return s_clockMainClkSrc[(SCG0->CSR & SCG_CSR_SCS_MASK) >> SCG_CSR_SCS_SHIFT];
+    }
+
+    for (i = 0U; i < ARRAY_SIZE(s_clockTreeConsumers); i++)
+    {
+        if (s_clockTreeConsumers[i].sel == (uint16_t)sel_name)
+        {
+            return CLOCK_GetConsumerOscillators(&s_clockTreeConsumers[i], true);
+        }
+    }
+
+    return 0U;
+}
+
+/*!
+ * brief Get the oscillators the running peripherals depend on.
+ * param mainClkRunning false for modes where the main clock is stopped.
+ * return Mask of clock_oscillator_t.
+ */
+uint32_t CLOCK_GetRequiredOscillators(bool mainClkRunning)
+{
+    const clock_tree_consumer_t *consumer;
+    uint32_t oscillators = 0U;
+    uint32_t i;
+
+    if (mainClkRunning)
+    {
+        oscillators = CLOCK_GetSelectOscillators(kCLOCK_SelSCGSCS);
+    }
+
+    for (i = 0U; i < ARRAY_SIZE(s_clockTreeConsumers); i++)
+    {
+        consumer = &s_clockTreeConsumers[i];
+        if ((consumer->gate == kCLOCK_GateNotAvail) || CLOCK_IsClockEnabled(consumer->gate))
+        {
+            oscillators |= CLOCK_GetConsumerOscillators(consumer, mainClkRunning);
+        }
+    }
+
+    return oscillators;
+}
+
+/*!
+ * brief Select the oscillators kept running in DeepSleep.
+ * param oscillators Mask of clock_oscillator_t to keep running.
+ */
+void CLOCK_SetLowPowerOscillators(uint32_t oscillators)
+{
+    SCG0->FIRCCSR &= ~SCG_FIRCCSR_LK_MASK;
+    SCG0->SIRCCSR &= ~SCG_SIRCCSR_LK_MASK;
+
+    if (0U != (oscillators & (uint32_t)kCLOCK_OscFroHf))
+    {
+        SCG0->FIRCCSR |= SCG_FIRCCSR_FIRCSTEN_MASK;
+    }
+    else
+    {
+        SCG0->FIRCCSR &= ~SCG_FIRCCSR_FIRCSTEN_MASK;
+    }
+
+    if (0U != (oscillators & (uint32_t)kCLOCK_OscFro12M))
+    {
+        SCG0->SIRCCSR |= SCG_SIRCCSR_SIRCSTEN_MASK;
+    }
+    else
+    {
+        SCG0->SIRCCSR &= ~SCG_SIRCCSR_SIRCSTEN_MASK;
+    }
+
+    SCG0->FIRCCSR |= SCG_FIRCCSR_LK_MASK;
+    SCG0->SIRCCSR |= SCG_SIRCCSR_LK_MASK;
+}
+
+/*!
+ * brief Get the oscillators kept running in DeepSleep.
+ * return Mask of clock_oscillator_t.
+ */
+uint32_t CLOCK_GetLowPowerOscillators(void)
+{
+    uint32_t oscillators = 0U;
+
+    if (0U != (SCG0->FIRCCSR & SCG_FIRCCSR_FIRCSTEN_MASK))
+    {
+        oscillators |= (uint32_t)kCLOCK_OscFroHf;
+    }
+    if (0U != (SCG0->SIRCCSR & SCG_SIRCCSR_SIRCSTEN_MASK))
+    {
+        oscillators |= (uint32_t)kCLOCK_OscFro12M;
+    }
+
+    return oscillators;
+}
+
 /*! brief Enable USB FS clock.
  * Enable USB Full Speed clock.
  */
@@ -39,6 +39,19 @@
 #define FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL 0
 #endif
 
+/*! @brief Configure whether computed clock frequencies are cached
+ *
+ * When set to 1, CLOCK_GetFreq(), CLOCK_GetMainClk(), CLOCK_GetCoreSysClkFreq() and
+ * CLOCK_GetLpuartClkFreq() compute a frequency once and return the cached value until the
+ * clock tree changes. All clock driver functions changing the clock tree invalidate the cache.
+ *
+ * @note Application code writing SCG, MRCC or SYSCON clock registers directly must call
+ * CLOCK_InvalidateFreqCache() afterwards.
+ */
+#if !(defined(FSL_CLOCK_FREQ_CACHE))
+#define FSL_CLOCK_FREQ_CACHE 1
+#endif
+
 /* Definition for delay API in clock driver, users can redefine it to the real application. */
 #ifndef SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY
 #define SDK_DEVICE_MAXIMUM_CPU_CLOCK_FREQUENCY (96000000UL)
@@ -533,6 +546,28 @@ typedef enum _clke_16k
     kCLKE_16K_COREMAIN = VBAT_FROCLKE_CLKE(2U)  /*!< To VDD_CORE domain. */
 } clke_16k_t;
 
+/*!
+ * @brief Oscillators at the roots of the clock tree, combined as a bit mask.
+ */
+typedef enum _clock_oscillator
+{
+    kCLOCK_OscFroHf  = (1U << 0U), /*!< FIRC: FRO_HF, FRO_HF_DIV and CLK_48M. */
+    kCLOCK_OscFro12M = (1U << 1U), /*!< SIRC: FRO_12M and CLK_1M. */
+    kCLOCK_OscFro16K = (1U << 2U), /*!< FRO16K in the VBAT domain: CLK_16K. */
+    kCLOCK_OscExt    = (1U << 3U), /*!< SOSC: CLK_IN. */
+} clock_oscillator_t;
+
+/*!
+ * @brief Clock gate audit, see CLOCK_GetClockGateAudit().
+ *
+ * Index 0 is MRCC_GLB_CC0, index 1 is MRCC_GLB_CC1, bit n is the gate with bit shift n.
+ */
+typedef struct _clock_gate_audit
+{
+    uint32_t open[2];    /*!< Gates currently open. */
+    uint32_t unowned[2]; /*!< Open gates without any CLOCK_RequestClock() reference. */
+} clock_gate_audit_t;
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -611,6 +646,91 @@ static inline void CLOCK_DisableClock(clock_ip_name_t clk)
     SYSCON->CLKUNLOCK |= SYSCON_CLKUNLOCK_UNLOCK_MASK;
 }
 
+/**
+ * @brief Check whether the clock for specific IP is enabled.
+ * @param clk : Clock to be checked.
+ * @return  true if the clock gate is open.
+ */
+static inline bool CLOCK_IsClockEnabled(clock_ip_name_t clk)
+{
+    uint32_t reg_offset = CLK_GATE_REG_OFFSET(clk);
+    uint32_t bit_shift  = CLK_GATE_BIT_SHIFT(clk);
+    const volatile uint32_t *pClkCtrl =
+        (const volatile uint32_t *)((uint32_t)(&(MRCC0->MRCC_GLB_CC0)) + reg_offset);
+
+    if (clk == kCLOCK_GateNotAvail)
+    {
+        return false;
+    }
+
+    if (reg_offset == REG_PWM0SUBCTL)
+    {
+        return (0U != (SYSCON->PWM0SUBCTL & (1UL << bit_shift)));
+    }
+
+    return (0U != (*pClkCtrl & (1UL << bit_shift)));
+}
+
+/**
+ * @brief Take a reference on the clock for specific IP.
+ *
+ * The clock is enabled by the first reference. A clock that was already enabled by
+ * CLOCK_EnableClock() when the first reference is taken stays enabled when the last
+ * reference is released, so both APIs can be used on the same gate.
+ *
+ * @param clk : Clock to be referenced.
+ * @return  Nothing
+ */
+void CLOCK_RequestClock(clock_ip_name_t clk);
+
+/**
+ * @brief Release a reference taken by CLOCK_RequestClock().
+ *
+ * The clock is gated as soon as the last reference is released.
+ *
+ * @param clk : Clock to be released.
+ * @return  Nothing
+ */
+void CLOCK_ReleaseClock(clock_ip_name_t clk);
+
+/**
+ * @brief Get the number of references on the clock for specific IP.
+ * @param clk : Clock to be checked.
+ * @return  Number of CLOCK_RequestClock() references.
+ */
+uint32_t CLOCK_GetClockRefCount(clock_ip_name_t clk);
+
+/**
+ * @brief Report the MRCC clock gates left open.
+ *
+ * Intended to be called on low power entry: an open gate without reference was enabled by
+ * CLOCK_EnableClock() and never gated again, and keeps its peripheral clocked while asleep.
+ *
+ * @param audit : Open and unowned gates.
+ * @return  Number of open gates without reference.
+ */
+uint32_t CLOCK_GetClockGateAudit(clock_gate_audit_t *audit);
+
+/**
+ * @brief Gate the MRCC clock gates left open without reference.
+ *
+ * Intended to be called right before a low power mode entry: closes the audit->unowned gates that
+ * still have no reference. Clear bits in audit->unowned to keep gates open. The flash, RAM and ROM
+ * controller gates are never closed. Reopen the gates with CLOCK_UngateClocks() after wake up.
+ *
+ * @param audit : Gates to close, from CLOCK_GetClockGateAudit(); on return the gates actually closed.
+ * @return  Nothing
+ */
+void CLOCK_GateUnownedClocks(clock_gate_audit_t *audit);
+
+/**
+ * @brief Reopen the clock gates closed by CLOCK_GateUnownedClocks().
+ *
+ * @param audit : Gates closed by CLOCK_GateUnownedClocks().
+ * @return  Nothing
+ */
+void CLOCK_UngateClocks(const clock_gate_audit_t *audit);
+
 /**
  * @brief   Configure the clock selection muxes.
  * @param   connection  : Clock to be configured.
@@ -674,6 +794,14 @@ void CLOCK_HaltClockDiv(clock_div_name_t div_name);
  */
 status_t CLOCK_SetupFROHFClocking(uint32_t iFreq);
 
+/**
+ * @brief   Stop the FROHF.
+ * This function turns off FROHF if neither the main clock nor a clocked peripheral uses it,
+ * see CLOCK_GetRequiredOscillators(). CLOCK_SetupFROHFClocking() turns it on again.
+ * @return  kStatus_Success, or kStatus_Busy if FROHF is still in use.
+ */
+status_t CLOCK_StopFROHFClocking(void);
+
 /**
  * @brief   Initialize the FRO12M.
  * This function turns on FRO12M.
@@ -705,6 +833,12 @@ status_t CLOCK_SetupExtClocking(uint32_t iFreq);
  */
 uint32_t CLOCK_GetFreq(clock_name_t clockName);
 
+/*! @brief  Invalidate the cached clock frequencies
+ *
+ * Needed only after writing clock registers without the clock driver.
+ */
+void CLOCK_InvalidateFreqCache(void);
+
 /*! @brief  Return Frequency of core
  *  @return Frequency of the core
  */
@@ -782,6 +916,7 @@ uint32_t CLOCK_GetWwdtClkFreq(void);
 
 /**
  * @brief   Setup FROHF trim.
+ * The FIRC enables and DeepSleep settings are kept.
  * @param   config   : FROHF trim value
  * @return  returns success or fail status.
  */
@@ -789,11 +924,27 @@ status_t CLOCK_FROHFTrimConfig(firc_trim_config_t config);
 
 /**
  * @brief   Setup FRO 12M trim.
+ * The SIRC enables and DeepSleep settings are kept.
  * @param   config   : FRO 12M trim value
  * @return  returns success or fail status.
  */
 status_t CLOCK_FRO12MTrimConfig(sirc_trim_config_t config);
 
+/**
+ * @brief   Get the FROHF trim in use.
+ * The factory trim until CLOCK_FROHFTrimConfig() enables trimming.
+ * @param   trimCoar : Coarse trim value
+ * @param   trimFine : Fine trim value
+ */
+void CLOCK_GetFROHFTrim(uint8_t *trimCoar, uint8_t *trimFine);
+
+/**
+ * @brief   Get the FRO 12M trim in use.
+ * @param   cltrim   : Coarse trim value
+ * @param   ccotrim  : Fine trim value
+ */
+void CLOCK_GetFRO12MTrim(uint8_t *cltrim, uint8_t *ccotrim);
+
 /*!
  * @brief Sets the system OSC monitor mode.
  *
@@ -809,6 +960,45 @@ void CLOCK_SetSysOscMonitorMode(scg_sosc_monitor_mode_t mode);
  */
 bool CLOCK_EnableUsbfsClock(void);
 
+/*!
+ * @brief Get the oscillators currently feeding a clock selection mux.
+ *
+ * Follows the selection, the FRO_HF_DIV and AHB dividers and the main clock
+ * selection down to the oscillators. A halted divider or a NONE selection feeds nothing.
+ *
+ * @param sel_name Clock selection, kCLOCK_SelSCGSCS for the main clock.
+ * @return Mask of clock_oscillator_t.
+ */
+uint32_t CLOCK_GetSelectOscillators(clock_select_name_t sel_name);
+
+/*!
+ * @brief Get the oscillators the running peripherals depend on.
+ *
+ * A peripheral functional clock counts when its MRCC gate is open (or it has no gate), its
+ * divider runs and its selection is not NONE.
+ *
+ * @param mainClkRunning false for modes where the main clock is stopped (DeepSleep and deeper):
+ *                       the main clock and the functional clocks taken from CPU_CLK are then ignored.
+ * @return Mask of clock_oscillator_t.
+ */
+uint32_t CLOCK_GetRequiredOscillators(bool mainClkRunning);
+
+/*!
+ * @brief Select the oscillators kept running in DeepSleep.
+ *
+ * Sets or clears FIRCSTEN and SIRCSTEN. FRO16K runs in all modes and SOSC is not handled.
+ *
+ * @param oscillators Mask of clock_oscillator_t to keep running.
+ */
+void CLOCK_SetLowPowerOscillators(uint32_t oscillators);
+
+/*!
+ * @brief Get the oscillators kept running in DeepSleep.
+ *
+ * @return Mask of clock_oscillator_t, kCLOCK_OscFroHf and kCLOCK_OscFro12M only.
+ */
+uint32_t CLOCK_GetLowPowerOscillators(void);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -241,6 +241,8 @@ void CMC_GlobalEnterLowPowerMode(CMC_Type *base, cmc_low_power_mode_t lowPowerMo
  */
 void CMC_EnterLowPowerMode(CMC_Type *base, const cmc_power_domain_config_t *config)
 {
+    uint32_t traceState = (uint32_t)kSDK_TraceStateActive;
+
     assert(config != NULL);
 
 #if (CMC_PMCTRL_COUNT > 1U)
@@ -268,11 +270,13 @@ void CMC_EnterLowPowerMode(CMC_Type *base, const cmc_power_domain_config_t *conf
         SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
         /* Toggle P3_30 for measure wake-up time */
         GPIO3->PTOR = 0x40000000; 
+        traceState = SDK_TraceState((uint32_t)kSDK_TraceStateModeEntry);
         __DSB();
         /* clear event */
         __WFE();
         /* enter low power mode*/
         __WFE(); 
+        (void)SDK_TraceState((uint32_t)kSDK_TraceStateWakeUp);
         /* Toggle P3_30 for measure wake-up time */
         GPIO3->PTOR = 0x40000000;      
     }
@@ -297,11 +301,13 @@ void CMC_EnterLowPowerMode(CMC_Type *base, const cmc_power_domain_config_t *conf
            SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
           /* Toggle P3_30 for measure wake-up time */
           GPIO3->PTOR = 0x40000000; 
+           traceState = SDK_TraceState((uint32_t)kSDK_TraceStateModeEntry);
            __DSB();
            /* clear event */
            __WFE();
            /* enter low power mode*/
            __WFE();
+           (void)SDK_TraceState((uint32_t)kSDK_TraceStateWakeUp);
            /* Toggle P3_30 for measure wake-up time */
            GPIO3->PTOR = 0x40000000; 
 #if (CMC_PMCTRL_COUNT > 1U)
@@ -312,4 +318,5 @@ void CMC_EnterLowPowerMode(CMC_Type *base, const cmc_power_domain_config_t *conf
     WUU0->PF|=WUU_PF_WUF9_MASK;                                     
     NVIC_ClearPendingIRQ(WUU0_IRQn);                                              
     NVIC_ClearPendingIRQ(Reserved16_IRQn);                                        
+    (void)SDK_TraceState(traceState);
 }
@@ -223,6 +223,15 @@ enum
 /*! @brief Type used for all status and error return values. */
 typedef int32_t status_t;
 
+/*! @brief Driver states passed to SDK_TraceState(). */
+enum _sdk_trace_state
+{
+    kSDK_TraceStateActive      = 0U, /*!< Code of the caller running. */
+    kSDK_TraceStateSpcBusyWait = 2U, /*!< Waiting for the SPC busy flag to clear. */
+    kSDK_TraceStateModeEntry   = 3U, /*!< Low power mode entry, last state before WFE/WFI. */
+    kSDK_TraceStateWakeUp      = 4U, /*!< First instruction after the core wakes up. */
+};
+
 /*!
  * @name Min/max macros
  * @{
@@ -304,6 +313,28 @@ void SDK_Free(void *ptr);
  */
 void SDK_DelayAtLeastUs(uint32_t delayTime_us, uint32_t coreClock_Hz);
 
+/*!
+ * @brief Waits part of a delay in a low power mode, called by SDK_DelayAtLeastUs().
+ *
+ * The default implementation is weak and waits nothing. An application with a timer that keeps running
+ * in a low power mode overrides it, peripherals in use by the caller must stay clocked.
+ *
+ * @param delayTime_us  Delay time in unit of microsecond.
+ * @return Part of the delay left to spin, in microseconds.
+ */
+uint32_t SDK_DelaySleep(uint32_t delayTime_us);
+
+/*!
+ * @brief Reports a driver state change, e.g. to a state trace bus.
+ *
+ * The default implementation is weak and reports nothing. The board overrides it to trace the
+ * drivers, the codes are from _sdk_trace_state.
+ *
+ * @param state New state.
+ * @return The state before, pass it back to restore the enclosing state.
+ */
+uint32_t SDK_TraceState(uint32_t state);
+
 #if defined(__cplusplus)
 }
 #endif
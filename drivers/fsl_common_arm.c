@@ -142,6 +142,21 @@ uint32_t MSDK_GetCpuCycleCount(void)
 }
 #endif /* defined(DWT) */
 
+/* The cycle counter gives exact delays at any core clock, use it where the core has one. Define
+ * SDK_DELAY_USE_LOOP to keep the software loop. */
+#if defined(DWT) && !defined(SDK_DELAY_USE_DWT) && !defined(SDK_DELAY_USE_LOOP)
+#define SDK_DELAY_USE_DWT
+#endif
+
+/* Shortest delay handed to SDK_DelaySleep(), shorter ones always spin. */
+#ifndef SDK_DELAY_SLEEP_MIN_US
+#define SDK_DELAY_SLEEP_MIN_US (20U)
+#endif
+
+/* Longest wait of one chunk, in cycles or loop counts. Half the counter range, so an elapsed count
+ * measured modulo 2^32 cannot be mistaken for a short one. */
+#define SDK_DELAY_MAX_CHUNK_CYCLES (0x80000000U)
+
 #if !(defined(SDK_DELAY_USE_DWT) && defined(DWT))
 /* Use software loop. */
 #if defined(__CC_ARM) /* This macro is arm v5 specific */
@@ -192,12 +207,39 @@ static void DelayLoop(uint32_t count)
 #endif /* defined(__CC_ARM) */
 #endif /* defined(SDK_DELAY_USE_DWT) && defined(DWT) */
 
+/*!
+ * @brief Waits part of a delay in a low power mode.
+ *
+ * Default implementation, waits nothing. The application overrides it with a timer based wait.
+ *
+ * @param delayTime_us  Delay time in unit of microsecond.
+ * @return Part of the delay left to spin, in microseconds.
+ */
+__WEAK uint32_t SDK_DelaySleep(uint32_t delayTime_us)
+{
+    return delayTime_us;
+}
+
+/*!
+ * @brief Reports a driver state change.
+ *
+ * Default implementation, reports nothing. The board overrides it with its state trace.
+ *
+ * @param state New state.
+ * @return The state before.
+ */
+__WEAK uint32_t SDK_TraceState(uint32_t state)
+{
+    (void)state;
+    return (uint32_t)kSDK_TraceStateActive;
+}
+
 /*!
  * @brief Delay at least for some time.
  *  Please note that, if not uses DWT, this API will use while loop for delay, different run-time environments have
- *  effect on the delay time. If precise delay is needed, please enable DWT delay. The two parmeters delayTime_us and
- *  coreClock_Hz have limitation. For example, in the platform with 1GHz coreClock_Hz, the delayTime_us only supports
- *  up to 4294967 in current code. If long time delay is needed, please implement a new delay function.
+ *  effect on the delay time. If precise delay is needed, please enable DWT delay. Delays longer than 2^31 cycles
+ *  are waited in chunks, so the whole delayTime_us range is supported at any coreClock_Hz.
+ *  Delays of at least SDK_DELAY_SLEEP_MIN_US are offered to SDK_DelaySleep() first.
  *
  * @param delayTime_us  Delay time in unit of microsecond.
  * @param coreClock_Hz  Core clock frequency with Hz.
@@ -205,31 +247,35 @@ static void DelayLoop(uint32_t count)
 void SDK_DelayAtLeastUs(uint32_t delayTime_us, uint32_t coreClock_Hz)
 {
     uint64_t count;
+    uint32_t chunk;
+#if defined(SDK_DELAY_USE_DWT) && defined(DWT)
+    uint32_t start;
+#endif
+
+    if (delayTime_us >= SDK_DELAY_SLEEP_MIN_US)
+    {
+        delayTime_us = SDK_DelaySleep(delayTime_us);
+    }
 
     if (delayTime_us > 0U)
     {
         count = USEC_TO_COUNT(delayTime_us, coreClock_Hz);
 
-        assert(count <= UINT32_MAX);
-
 #if defined(SDK_DELAY_USE_DWT) && defined(DWT) /* Use DWT for better accuracy */
 
         MSDK_EnableCpuCycleCounter();
-        /* Calculate the count ticks. */
-        count += MSDK_GetCpuCycleCount();
 
-        if (count > UINT32_MAX)
+        /* Chunks below 2^31 cycles, so a long delay at a fast core clock is not truncated. */
+        while (count > 0U)
         {
-            count -= UINT32_MAX;
-            /* Wait for cyccnt overflow. */
-            while (count < MSDK_GetCpuCycleCount())
+            chunk = (uint32_t)MIN(count, SDK_DELAY_MAX_CHUNK_CYCLES);
+            start = MSDK_GetCpuCycleCount();
+
+            /* Elapsed cycles, modulo 2^32: correct across a counter wrap. */
+            while ((MSDK_GetCpuCycleCount() - start) < chunk)
             {
             }
-        }
-
-        /* Wait for cyccnt reach count value. */
-        while (count > MSDK_GetCpuCycleCount())
-        {
+            count -= chunk;
         }
 #else
         /* Divide value may be different in various environment to ensure delay is precise.
@@ -243,7 +289,12 @@ void SDK_DelayAtLeastUs(uint32_t delayTime_us, uint32_t coreClock_Hz)
 #else
         count = count / 4U;
 #endif
-        DelayLoop((uint32_t)count);
+        while (count > 0U)
+        {
+            chunk = (uint32_t)MIN(count, SDK_DELAY_MAX_CHUNK_CYCLES);
+            DelayLoop(chunk);
+            count -= chunk;
+        }
 #endif /* defined(SDK_DELAY_USE_DWT) && defined(DWT) */
     }
 }
@@ -0,0 +1,221 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_freqme.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.freqme"
+#endif
+
+/* CTRLSTAT fields written back through CTRL_W, the status flags and the start bit excluded. */
+#define FREQME_CTRL_KEEP_MASK                                                                          \
+    (FREQME_CTRLSTAT_REF_SCALE_MASK | FREQME_CTRLSTAT_PULSE_MODE_MASK | FREQME_CTRLSTAT_PULSE_POL_MASK | \
+     FREQME_CTRLSTAT_LT_MIN_INT_EN_MASK | FREQME_CTRLSTAT_GT_MAX_INT_EN_MASK |                         \
+     FREQME_CTRLSTAT_RESULT_READY_INT_EN_MASK | FREQME_CTRLSTAT_CONTINUOUS_MODE_EN_MASK)
+
+/* The result counts two synchronization clocks on top of the target clocks. */
+#define FREQME_RESULT_OFFSET (2U)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+/*!
+ * brief Gets the instance from the base address
+ *
+ * param base FREQME peripheral base address
+ *
+ * return The FREQME instance
+ */
+static uint32_t FREQME_GetInstance(FREQME_Type *base);
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+/* Array of FREQME peripheral base address. */
+static FREQME_Type *const s_freqmeBases[] = FREQME_BASE_PTRS;
+/* Array of FREQME clock name. */
+static const clock_ip_name_t s_freqmeClocks[] = FREQME_CLOCKS;
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+/* brief Function for getting the instance number of FREQME. */
+static uint32_t FREQME_GetInstance(FREQME_Type *base)
+{
+    uint32_t instance;
+
+    /* Find the instance index from base address mappings. */
+    for (instance = 0; instance < ARRAY_SIZE(s_freqmeBases); instance++)
+    {
+        if (s_freqmeBases[instance] == base)
+        {
+            break;
+        }
+    }
+
+    assert(instance < ARRAY_SIZE(s_freqmeBases));
+
+    return instance;
+}
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+
+/*!
+ * brief Initializes a FREQME.
+ * param base FREQME peripheral base address.
+ * param config Pointer to the user configuration structure.
+ */
+void FREQME_Init(FREQME_Type *base, const freqme_config_t *config)
+{
+    assert(NULL != base);
+    assert(NULL != config);
+    assert(config->refClkScaleFactor <= FREQME_MAX_REF_SCALE);
+
+    uint32_t ctrl;
+
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+    CLOCK_RequestClock(s_freqmeClocks[FREQME_GetInstance(base)]);
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+
+    if (config->operateMode == kFREQME_PulseWidthMeasurementMode)
+    {
+        ctrl = FREQME_CTRL_W_PULSE_MODE_MASK | FREQME_CTRL_W_PULSE_POL((uint32_t)config->pulsePolarity);
+    }
+    else
+    {
+        ctrl = FREQME_CTRL_W_REF_SCALE(config->refClkScaleFactor);
+    }
+
+    if (config->enableContinuousMode)
+    {
+        ctrl |= FREQME_CTRL_W_CONTINUOUS_MODE_EN_MASK;
+    }
+
+    if (config->startMeasurement)
+    {
+        ctrl |= FREQME_CTRL_W_MEASURE_IN_PROGRESS_MASK;
+    }
+
+    FREQME_ClearStatusFlags(base, (uint32_t)kFREQME_AllFlags);
+    base->CTRL_W = ctrl;
+}
+
+/*!
+ * brief Deinitializes a FREQME instance.
+ * param base FREQME peripheral base address.
+ */
+void FREQME_Deinit(FREQME_Type *base)
+{
+    assert(NULL != base);
+
+    base->CTRL_W = 0U;
+    FREQME_ClearStatusFlags(base, (uint32_t)kFREQME_AllFlags);
+
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+    CLOCK_ReleaseClock(s_freqmeClocks[FREQME_GetInstance(base)]);
+#endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
+}
+
+/*!
+ * brief  Fills in the FREQME configuration structure with the default settings.
+ * param config Pointer to the user configuration structure.
+ */
+void FREQME_GetDefaultConfig(freqme_config_t *config)
+{
+    assert(NULL != config);
+
+    /* Initializes the configure structure to zero. */
+    (void)memset(config, 0, sizeof(*config));
+
+    config->operateMode          = kFREQME_FreqMeasurementMode;
+    config->refClkScaleFactor    = 0U;
+    config->pulsePolarity        = kFREQME_PulseHighPeriod;
+    config->enableContinuousMode = false;
+    config->startMeasurement     = false;
+}
+
+/*!
+ * brief Sets the reference clock scale of the frequency measurement mode.
+ * param base FREQME peripheral base address.
+ * param scale The reference count is 2^scale.
+ */
+void FREQME_SetReferenceClkScaleValue(FREQME_Type *base, uint8_t scale)
+{
+    assert(scale <= FREQME_MAX_REF_SCALE);
+
+    /* Writing CTRL_W without the start bit also terminates a measurement in progress. */
+    base->CTRL_W = (base->CTRLSTAT & FREQME_CTRL_KEEP_MASK & ~FREQME_CTRLSTAT_REF_SCALE_MASK) |
+                   FREQME_CTRL_W_REF_SCALE(scale);
+}
+
+/*!
+ * brief Waits for the measurement in progress and computes the target clock frequency.
+ * param base FREQME peripheral base address.
+ * param refClkFrequency Reference clock frequency in Hz.
+ * return The target clock frequency in Hz.
+ */
+uint32_t FREQME_CalculateTargetClkFreq(FREQME_Type *base, uint32_t refClkFrequency)
+{
+    uint32_t result;
+    uint64_t freq;
+
+    while (FREQME_IsMeasurementInProgress(base))
+    {
+    }
+
+    if ((base->CTRLSTAT & FREQME_CTRLSTAT_PULSE_MODE_MASK) != 0U)
+    {
+        return 0U;
+    }
+
+    result = FREQME_GetMeasurementResult(base);
+    if (result <= FREQME_RESULT_OFFSET)
+    {
+        return 0U;
+    }
+
+    freq = ((uint64_t)result - FREQME_RESULT_OFFSET) * (uint64_t)refClkFrequency;
+
+    return (uint32_t)(freq >> FREQME_GetReferenceClkScaleValue(base));
+}
+
+/*!
+ * brief Enables the selected FREQME interrupts.
+ * param base FREQME peripheral base address.
+ * param mask Mask value for interrupt events.
+ */
+void FREQME_EnableInterrupts(FREQME_Type *base, uint32_t mask)
+{
+    uint32_t ctrl = base->CTRLSTAT;
+
+    /* Keep a measurement in progress running. */
+    base->CTRL_W = (ctrl & (FREQME_CTRL_KEEP_MASK | FREQME_CTRLSTAT_MEASURE_IN_PROGRESS_MASK)) |
+                   (mask & ((uint32_t)kFREQME_UnderflowInterruptEnable | (uint32_t)kFREQME_OverflowInterruptEnable |
+                            (uint32_t)kFREQME_ReadyInterruptEnable));
+}
+
+/*!
+ * brief Disables the selected FREQME interrupts.
+ * param base FREQME peripheral base address.
+ * param mask Mask value for interrupt events.
+ */
+void FREQME_DisableInterrupts(FREQME_Type *base, uint32_t mask)
+{
+    uint32_t ctrl = base->CTRLSTAT;
+
+    base->CTRL_W = ctrl & (FREQME_CTRL_KEEP_MASK | FREQME_CTRLSTAT_MEASURE_IN_PROGRESS_MASK) & ~mask;
+}
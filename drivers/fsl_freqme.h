@@ -0,0 +1,294 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _FSL_FREQME_H_
+#define _FSL_FREQME_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup freqme
+ * @{
+ */
+
+/*! @file*/
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*@{*/
+/*! @brief FREQME driver version. */
+#define FSL_FREQME_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*@}*/
+
+/*! @brief Largest reference clock scale, the reference count is 2^31. */
+#define FREQME_MAX_REF_SCALE (31U)
+
+/*!
+ * @brief FREQME status flags.
+ */
+enum _freqme_status_flags
+{
+    kFREQME_UnderflowFlag = FREQME_CTRLSTAT_LT_MIN_STAT_MASK,       /*!< Result is less than the minimum value. */
+    kFREQME_OverflowFlag  = FREQME_CTRLSTAT_GT_MAX_STAT_MASK,       /*!< Result is greater than the maximum value. */
+    kFREQME_ReadyFlag     = FREQME_CTRLSTAT_RESULT_READY_STAT_MASK, /*!< Measurement result is ready. */
+    kFREQME_AllFlags      = kFREQME_UnderflowFlag | kFREQME_OverflowFlag | kFREQME_ReadyFlag,
+};
+
+/*!
+ * @brief Define interrupt switchers of the module.
+ */
+enum _freqme_interrupt_enable
+{
+    kFREQME_UnderflowInterruptEnable = FREQME_CTRL_W_LT_MIN_INT_EN_MASK, /*!< Interrupt when the result is less than
+                                                                              the minimum value. */
+    kFREQME_OverflowInterruptEnable = FREQME_CTRL_W_GT_MAX_INT_EN_MASK,  /*!< Interrupt when the result is greater
+                                                                              than the maximum value. */
+    kFREQME_ReadyInterruptEnable = FREQME_CTRL_W_RESULT_READY_INT_EN_MASK, /*!< Interrupt when a result is ready. */
+};
+
+/*! @brief FREQME operate mode. */
+typedef enum _freqme_operate_mode
+{
+    kFREQME_FreqMeasurementMode       = 0U, /*!< Count the target clock over 2^refClkScaleFactor reference clocks. */
+    kFREQME_PulseWidthMeasurementMode = 1U, /*!< Count the reference clock over one target pulse. */
+} freqme_operate_mode_t;
+
+/*! @brief Pulse polarity of the pulse width measurement mode. */
+typedef enum _freqme_pulse_polarity
+{
+    kFREQME_PulseHighPeriod = 0U, /*!< Measure the high period of the target. */
+    kFREQME_PulseLowPeriod  = 1U, /*!< Measure the low period of the target. */
+} freqme_pulse_polarity_t;
+
+/*!
+ * @brief FREQME configuration structure
+ *
+ * To initialize this structure to reasonable defaults, call the FREQME_GetDefaultConfig() function
+ * and pass a pointer to the configuration structure instance.
+ */
+typedef struct _freqme_config
+{
+    freqme_operate_mode_t operateMode;     /*!< Operate mode. */
+    uint8_t refClkScaleFactor;             /*!< Frequency measurement mode: the reference count is
+                                                2^refClkScaleFactor, up to FREQME_MAX_REF_SCALE. */
+    freqme_pulse_polarity_t pulsePolarity; /*!< Pulse width measurement mode: measured period. */
+    bool enableContinuousMode;             /*!< true: Start a new measurement after each result. */
+    bool startMeasurement;                 /*!< true: Start a measurement at the end of FREQME_Init(). */
+} freqme_config_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* _cplusplus */
+
+/*!
+ * @name Initialization and deinitialization
+ * @{
+ */
+
+/*!
+ * @brief Initializes a FREQME.
+ *
+ * This function ungates the FREQME clock and applies the configuration. The reference and the target
+ * are selected in INPUTMUX FREQMEAS_REF and FREQMEAS_TAR.
+ *
+ * @param base FREQME peripheral base address.
+ * @param config Pointer to the user configuration structure.
+ */
+void FREQME_Init(FREQME_Type *base, const freqme_config_t *config);
+
+/*!
+ * @brief Deinitializes a FREQME instance.
+ *
+ * This function stops any measurement and releases the FREQME clock reference taken by FREQME_Init().
+ *
+ * @param base FREQME peripheral base address.
+ */
+void FREQME_Deinit(FREQME_Type *base);
+
+/*!
+ * @brief  Fills in the FREQME configuration structure with the default settings.
+ *
+ * The default values are:
+ * @code
+ *  config->operateMode          = kFREQME_FreqMeasurementMode;
+ *  config->refClkScaleFactor    = 0U;
+ *  config->pulsePolarity        = kFREQME_PulseHighPeriod;
+ *  config->enableContinuousMode = false;
+ *  config->startMeasurement     = false;
+ * @endcode
+ * @param config Pointer to the user configuration structure.
+ */
+void FREQME_GetDefaultConfig(freqme_config_t *config);
+
+/*! @}*/
+
+/*!
+ * @name Measurement control
+ * @{
+ */
+
+/*!
+ * @brief Starts a measurement cycle.
+ *
+ * The other control fields are kept. CTRL_W is write only, they are read back from CTRLSTAT.
+ *
+ * @param base FREQME peripheral base address.
+ */
+static inline void FREQME_StartMeasurementCycle(FREQME_Type *base)
+{
+    base->CTRL_W = (base->CTRLSTAT & ~(kFREQME_AllFlags | FREQME_CTRLSTAT_MEASURE_IN_PROGRESS_MASK)) |
+                   FREQME_CTRL_W_MEASURE_IN_PROGRESS_MASK;
+}
+
+/*!
+ * @brief Terminates the measurement cycle in progress, its result is lost.
+ *
+ * @param base FREQME peripheral base address.
+ */
+static inline void FREQME_TerminateMeasurementCycle(FREQME_Type *base)
+{
+    base->CTRL_W = base->CTRLSTAT & ~(kFREQME_AllFlags | FREQME_CTRLSTAT_MEASURE_IN_PROGRESS_MASK |
+                                      FREQME_CTRLSTAT_CONTINUOUS_MODE_EN_MASK);
+}
+
+/*!
+ * @brief Checks whether a measurement cycle is in progress.
+ *
+ * @param base FREQME peripheral base address.
+ * @return true while a measurement is in progress.
+ */
+static inline bool FREQME_IsMeasurementInProgress(FREQME_Type *base)
+{
+    return ((base->CTRL_R & FREQME_CTRL_R_MEASURE_IN_PROGRESS_MASK) != 0U);
+}
+
+/*!
+ * @brief Sets the reference clock scale of the frequency measurement mode.
+ *
+ * @param base FREQME peripheral base address.
+ * @param scale The reference count is 2^scale, up to FREQME_MAX_REF_SCALE.
+ */
+void FREQME_SetReferenceClkScaleValue(FREQME_Type *base, uint8_t scale);
+
+/*!
+ * @brief Gets the reference clock scale of the frequency measurement mode.
+ *
+ * @param base FREQME peripheral base address.
+ * @return The reference count is 2^scale.
+ */
+static inline uint8_t FREQME_GetReferenceClkScaleValue(FREQME_Type *base)
+{
+    return (uint8_t)(base->CTRLSTAT & FREQME_CTRLSTAT_REF_SCALE_MASK);
+}
+
+/*!
+ * @brief Sets the minimum expected result, a smaller result sets kFREQME_UnderflowFlag.
+ *
+ * @param base FREQME peripheral base address.
+ * @param minValue Minimum expected result.
+ */
+static inline void FREQME_SetMinExpectedValue(FREQME_Type *base, uint32_t minValue)
+{
+    base->MIN = FREQME_MIN_MIN_VALUE(minValue);
+}
+
+/*!
+ * @brief Sets the maximum expected result, a greater result sets kFREQME_OverflowFlag.
+ *
+ * @param base FREQME peripheral base address.
+ * @param maxValue Maximum expected result.
+ */
+static inline void FREQME_SetMaxExpectedValue(FREQME_Type *base, uint32_t maxValue)
+{
+    base->MAX = FREQME_MAX_MAX_VALUE(maxValue);
+}
+
+/*!
+ * @brief Gets the raw result of the last measurement.
+ *
+ * Frequency measurement mode: number of target clocks over 2^scale reference clocks, plus 2.
+ * Pulse width measurement mode: number of reference clocks over the target pulse.
+ *
+ * @param base FREQME peripheral base address.
+ * @return The raw result.
+ */
+static inline uint32_t FREQME_GetMeasurementResult(FREQME_Type *base)
+{
+    return (base->CTRL_R & FREQME_CTRL_R_RESULT_MASK);
+}
+
+/*!
+ * @brief Waits for the measurement in progress and computes the target clock frequency.
+ *
+ * Only valid in the frequency measurement mode. The result is (count - 2) * refClkFrequency / 2^scale.
+ *
+ * @param base FREQME peripheral base address.
+ * @param refClkFrequency Reference clock frequency in Hz.
+ * @return The target clock frequency in Hz, 0 in the pulse width measurement mode.
+ */
+uint32_t FREQME_CalculateTargetClkFreq(FREQME_Type *base, uint32_t refClkFrequency);
+
+/*! @}*/
+
+/*!
+ * @name Status and interrupt interface
+ * @{
+ */
+
+/*!
+ * @brief Gets the status flags.
+ *
+ * @param base FREQME peripheral base address.
+ * @return Mask of the asserted flags. See to #_freqme_status_flags.
+ */
+static inline uint32_t FREQME_GetStatusFlags(FREQME_Type *base)
+{
+    return (base->CTRLSTAT & (uint32_t)kFREQME_AllFlags);
+}
+
+/*!
+ * @brief Clears status flags.
+ *
+ * @param base FREQME peripheral base address.
+ * @param mask Mask value for flags to be cleared. See to #_freqme_status_flags.
+ */
+static inline void FREQME_ClearStatusFlags(FREQME_Type *base, uint32_t mask)
+{
+    base->CTRLSTAT = mask & (uint32_t)kFREQME_AllFlags;
+}
+
+/*!
+ * @brief Enables the selected FREQME interrupts.
+ *
+ * @param base FREQME peripheral base address.
+ * @param mask Mask value for interrupt events. See to #_freqme_interrupt_enable
+ */
+void FREQME_EnableInterrupts(FREQME_Type *base, uint32_t mask);
+
+/*!
+ * @brief Disables the selected FREQME interrupts.
+ *
+ * @param base FREQME peripheral base address.
+ * @param mask Mask value for interrupt events. See to #_freqme_interrupt_enable
+ */
+void FREQME_DisableInterrupts(FREQME_Type *base, uint32_t mask);
+
+/*! @}*/
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_FREQME_H_ */
@@ -86,10 +86,10 @@ void LPTMR_Init(LPTMR_Type *base, const lptmr_config_t *config)
 
     uint32_t instance = LPTMR_GetInstance(base);
 
-    /* Ungate the LPTMR clock*/
-    CLOCK_EnableClock(s_lptmrClocks[instance]);
+    /* Take a reference on the LPTMR clock, released by LPTMR_Deinit*/
+    CLOCK_RequestClock(s_lptmrClocks[instance]);
 #if defined(LPTMR_PERIPH_CLOCKS)
-    CLOCK_EnableClock(s_lptmrPeriphClocks[instance]);
+    CLOCK_RequestClock(s_lptmrPeriphClocks[instance]);
 #endif
 
 #endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
@@ -119,10 +119,10 @@ void LPTMR_Deinit(LPTMR_Type *base)
 
     uint32_t instance = LPTMR_GetInstance(base);
 
-    /* Gate the LPTMR clock*/
-    CLOCK_DisableClock(s_lptmrClocks[instance]);
+    /* Release the LPTMR clock, gated with its last reference*/
+    CLOCK_ReleaseClock(s_lptmrClocks[instance]);
 #if defined(LPTMR_PERIPH_CLOCKS)
-    CLOCK_DisableClock(s_lptmrPeriphClocks[instance]);
+    CLOCK_ReleaseClock(s_lptmrPeriphClocks[instance]);
 #endif
 
 #endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
@@ -143,7 +143,7 @@ extern "C" {
 void LPTMR_Init(LPTMR_Type *base, const lptmr_config_t *config);
 
 /*!
- * @brief Gates the LPTMR clock.
+ * @brief Releases the LPTMR clock reference taken by LPTMR_Init(), the clock is gated with its last reference.
  *
  * @param base LPTMR peripheral base address
  */
@@ -26,6 +26,18 @@
 #define FSL_COMPONENT_ID "platform.drivers.lpuart"
 #endif
 
+#if (LPUART_BAUD_CACHE_SIZE > 0U)
+/* Divisors found for a source clock and baud rate. */
+typedef struct _lpuart_baud_cache_entry
+{
+    uint32_t srcClock_Hz;  /* Source clock, in Hz. */
+    uint32_t baudRate_Bps; /* Requested baud rate, 0 for an unused entry. */
+    uint32_t baudDiff;     /* Difference between the requested and the actual baud rate. */
+    uint16_t sbr;          /* Best SBR value. */
+    uint8_t osr;           /* Best OSR value. */
+} lpuart_baud_cache_entry_t;
+#endif
+
 /* LPUART transfer state. */
 enum
 {
@@ -111,6 +123,20 @@ static void LPUART_TransferHandleSendDataEmpty(LPUART_Type *base, lpuart_handle_
  */
 static void LPUART_TransferHandleTransmissionComplete(LPUART_Type *base, lpuart_handle_t *handle);
 
+/*!
+ * @brief Finds the OSR and SBR values giving the closest baud rate.
+ *
+ * The search tries every OSR value, its result is remembered so that re-initializing the
+ * LPUART with the same clock and baud rate, for example after each low power wake up, skips it.
+ *
+ * @param baudRate_Bps Requested baud rate.
+ * @param srcClock_Hz LPUART clock source frequency in HZ.
+ * @param osr Best OSR value.
+ * @param sbr Best SBR value.
+ * @return Difference between the requested and the actual baud rate.
+ */
+static uint32_t LPUART_CalculateBaudDivisor(uint32_t baudRate_Bps, uint32_t srcClock_Hz, uint8_t *osr, uint16_t *sbr);
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
@@ -139,6 +165,12 @@ static const clock_ip_name_t s_lpuartPeriphClocks[] = LPUART_PERIPH_CLOCKS;
 
 #endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
 
+#if (LPUART_BAUD_CACHE_SIZE > 0U)
+/* Remembered baud rate divisors, replaced in round robin order. */
+static lpuart_baud_cache_entry_t s_lpuartBaudCache[LPUART_BAUD_CACHE_SIZE];
+static uint8_t s_lpuartBaudCacheNext;
+#endif
+
 /* LPUART ISR for transactional APIs. */
 #if defined(__ARMCC_VERSION) && (__ARMCC_VERSION >= 6010050)
 lpuart_isr_t s_lpuartIsr[ARRAY_SIZE(s_lpuartBases)] = {[0 ...(ARRAY_SIZE(s_lpuartBases) - 1)] =
@@ -185,6 +217,82 @@ uint32_t LPUART_GetInstance(LPUART_Type *base)
     return instance;
 }
 
+static uint32_t LPUART_CalculateBaudDivisor(uint32_t baudRate_Bps, uint32_t srcClock_Hz, uint8_t *osr, uint16_t *sbr)
+{
+    uint16_t sbrTemp;
+    uint8_t osrTemp;
+    uint32_t tempDiff, calculatedBaud, baudDiff;
+#if (LPUART_BAUD_CACHE_SIZE > 0U)
+    lpuart_baud_cache_entry_t *entry;
+    uint32_t i;
+
+    for (i = 0U; i < LPUART_BAUD_CACHE_SIZE; i++)
+    {
+        entry = &s_lpuartBaudCache[i];
+        if ((entry->baudRate_Bps == baudRate_Bps) && (entry->srcClock_Hz == srcClock_Hz))
+        {
+            *osr = entry->osr;
+            *sbr = entry->sbr;
+            return entry->baudDiff;
+        }
+    }
+#endif
+
+    /* This LPUART instantiation uses a slightly different baud rate calculation
+     * The idea is to use the best OSR (over-sampling rate) possible
+     * Note, OSR is typically hard-set to 16 in other LPUART instantiations
+     * loop to find the best OSR value possible, one that generates minimum baudDiff
+     * iterate through the rest of the supported values of OSR */
+
+    baudDiff = baudRate_Bps;
+    *osr     = 0U;
+    *sbr     = 0U;
+    for (osrTemp = 4U; osrTemp <= 32U; osrTemp++)
+    {
+        /* calculate the temporary sbr value   */
+        sbrTemp = (uint16_t)((srcClock_Hz * 10U / (baudRate_Bps * (uint32_t)osrTemp) + 5U) / 10U);
+        /*set sbrTemp to 1 if the sourceClockInHz can not satisfy the desired baud rate*/
+        if (sbrTemp == 0U)
+        {
+            sbrTemp = 1U;
+        }
+        else if (sbrTemp > LPUART_BAUD_SBR_MASK)
+        {
+            sbrTemp = LPUART_BAUD_SBR_MASK;
+        }
+        else
+        {
+            /* Avoid MISRA 15.7 */
+        }
+        /* Calculate the baud rate based on the temporary OSR and SBR values */
+        calculatedBaud = srcClock_Hz / ((uint32_t)osrTemp * (uint32_t)sbrTemp);
+
+        tempDiff = calculatedBaud > baudRate_Bps ? (calculatedBaud - baudRate_Bps) : (baudRate_Bps - calculatedBaud);
+
+        if (tempDiff <= baudDiff)
+        {
+            baudDiff = tempDiff;
+            *osr     = osrTemp; /* update and store the best OSR value calculated */
+            *sbr     = sbrTemp; /* update store the best SBR value calculated */
+        }
+    }
+
+#if (LPUART_BAUD_CACHE_SIZE > 0U)
+    /* Invalidate the entry while it is rewritten. */
+    entry               = &s_lpuartBaudCache[s_lpuartBaudCacheNext];
+    entry->baudRate_Bps = 0U;
+    entry->srcClock_Hz  = srcClock_Hz;
+    entry->baudDiff     = baudDiff;
+    entry->osr          = *osr;
+    entry->sbr          = *sbr;
+    entry->baudRate_Bps = baudRate_Bps;
+
+    s_lpuartBaudCacheNext = (uint8_t)((s_lpuartBaudCacheNext + 1U) % LPUART_BAUD_CACHE_SIZE);
+#endif
+
+    return baudDiff;
+}
+
 /*!
  * brief Get the length of received data in RX ring buffer.
  *
@@ -308,48 +416,11 @@ status_t LPUART_Init(LPUART_Type *base, const lpuart_config_t *config, uint32_t
 
     status_t status = kStatus_Success;
     uint32_t temp;
-    uint16_t sbr, sbrTemp;
-    uint8_t osr, osrTemp;
-    uint32_t tempDiff, calculatedBaud, baudDiff;
-
-    /* This LPUART instantiation uses a slightly different baud rate calculation
-     * The idea is to use the best OSR (over-sampling rate) possible
-     * Note, OSR is typically hard-set to 16 in other LPUART instantiations
-     * loop to find the best OSR value possible, one that generates minimum baudDiff
-     * iterate through the rest of the supported values of OSR */
+    uint16_t sbr;
+    uint8_t osr;
+    uint32_t baudDiff;
 
-    baudDiff = config->baudRate_Bps;
-    osr      = 0U;
-    sbr      = 0U;
-    for (osrTemp = 4U; osrTemp <= 32U; osrTemp++)
-    {
-        /* calculate the temporary sbr value   */
-        sbrTemp = (uint16_t)((srcClock_Hz * 10U / (config->baudRate_Bps * (uint32_t)osrTemp) + 5U) / 10U);
-        /*set sbrTemp to 1 if the sourceClockInHz can not satisfy the desired baud rate*/
-        if (sbrTemp == 0U)
-        {
-            sbrTemp = 1U;
-        }
-		else if (sbrTemp > LPUART_BAUD_SBR_MASK)
-        {
-            sbrTemp = LPUART_BAUD_SBR_MASK;
-        }
-        else
-        {
-            /* Avoid MISRA 15.7 */
-        }
-        /* Calculate the baud rate based on the temporary OSR and SBR values */
-        calculatedBaud = (srcClock_Hz / ((uint32_t)osrTemp * (uint32_t)sbrTemp));
-        tempDiff       = calculatedBaud > config->baudRate_Bps ? (calculatedBaud - config->baudRate_Bps) :
-                                                           (config->baudRate_Bps - calculatedBaud);
-
-        if (tempDiff <= baudDiff)
-        {
-            baudDiff = tempDiff;
-            osr      = osrTemp; /* update and store the best OSR value calculated */
-            sbr      = sbrTemp; /* update store the best SBR value calculated */
-        }
-    }
+    baudDiff = LPUART_CalculateBaudDivisor(config->baudRate_Bps, srcClock_Hz, &osr, &sbr);
 
     /* Check to see if actual baud rate is within 3% of desired baud rate
      * based on the best calculate OSR value */
@@ -364,10 +435,10 @@ status_t LPUART_Init(LPUART_Type *base, const lpuart_config_t *config, uint32_t
 
         uint32_t instance = LPUART_GetInstance(base);
 
-        /* Enable lpuart clock */
-        (void)CLOCK_EnableClock(s_lpuartClock[instance]);
+        /* Take a reference on the lpuart clock, released by LPUART_Deinit */
+        CLOCK_RequestClock(s_lpuartClock[instance]);
 #if defined(LPUART_PERIPH_CLOCKS)
-        (void)CLOCK_EnableClock(s_lpuartPeriphClocks[instance]);
+        CLOCK_RequestClock(s_lpuartPeriphClocks[instance]);
 #endif
 
 #endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
@@ -556,11 +627,11 @@ void LPUART_Deinit(LPUART_Type *base)
 #if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
     uint32_t instance = LPUART_GetInstance(base);
 
-    /* Disable lpuart clock */
-    (void)CLOCK_DisableClock(s_lpuartClock[instance]);
+    /* Release the lpuart clock, gated with its last reference */
+    CLOCK_ReleaseClock(s_lpuartClock[instance]);
 
 #if defined(LPUART_PERIPH_CLOCKS)
-    (void)CLOCK_DisableClock(s_lpuartPeriphClocks[instance]);
+    CLOCK_ReleaseClock(s_lpuartPeriphClocks[instance]);
 #endif
 
 #endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
@@ -636,48 +707,11 @@ status_t LPUART_SetBaudRate(LPUART_Type *base, uint32_t baudRate_Bps, uint32_t s
 
     status_t status = kStatus_Success;
     uint32_t temp, oldCtrl;
-    uint16_t sbr, sbrTemp;
-    uint8_t osr, osrTemp;
-    uint32_t tempDiff, calculatedBaud, baudDiff;
-
-    /* This LPUART instantiation uses a slightly different baud rate calculation
-     * The idea is to use the best OSR (over-sampling rate) possible
-     * Note, OSR is typically hard-set to 16 in other LPUART instantiations
-     * loop to find the best OSR value possible, one that generates minimum baudDiff
-     * iterate through the rest of the supported values of OSR */
+    uint16_t sbr;
+    uint8_t osr;
+    uint32_t baudDiff;
 
-    baudDiff = baudRate_Bps;
-    osr      = 0U;
-    sbr      = 0U;
-    for (osrTemp = 4U; osrTemp <= 32U; osrTemp++)
-    {
-        /* calculate the temporary sbr value   */
-        sbrTemp = (uint16_t)((srcClock_Hz * 10U / (baudRate_Bps * (uint32_t)osrTemp) + 5U) / 10U);
-        /*set sbrTemp to 1 if the sourceClockInHz can not satisfy the desired baud rate*/
-        if (sbrTemp == 0U)
-        {
-            sbrTemp = 1U;
-        }
-        else if (sbrTemp > LPUART_BAUD_SBR_MASK)
-        {
-            sbrTemp = LPUART_BAUD_SBR_MASK;
-        }
-        else
-        {
-            /* Avoid MISRA 15.7 */
-        }
-        /* Calculate the baud rate based on the temporary OSR and SBR values */
-        calculatedBaud = srcClock_Hz / ((uint32_t)osrTemp * (uint32_t)sbrTemp);
-
-        tempDiff = calculatedBaud > baudRate_Bps ? (calculatedBaud - baudRate_Bps) : (baudRate_Bps - calculatedBaud);
-
-        if (tempDiff <= baudDiff)
-        {
-            baudDiff = tempDiff;
-            osr      = osrTemp; /* update and store the best OSR value calculated */
-            sbr      = sbrTemp; /* update store the best SBR value calculated */
-        }
-    }
+    baudDiff = LPUART_CalculateBaudDivisor(baudRate_Bps, srcClock_Hz, &osr, &sbr);
 
     /* Check to see if actual baud rate is within 3% of desired baud rate
      * based on the best calculate OSR value */
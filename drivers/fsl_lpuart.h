@@ -30,6 +30,11 @@
 #define UART_RETRY_TIMES 0U /* Defining to zero means to keep waiting for the flag until it is assert/deassert. */
 #endif
 
+/*! @brief Number of baud rate divisor results remembered, 0 to search the divisors on every call. */
+#ifndef LPUART_BAUD_CACHE_SIZE
+#define LPUART_BAUD_CACHE_SIZE 2U /* Enough for the debug console at its boot and wake up clocks. */
+#endif
+
 /*! @brief Error codes for the LPUART driver. */
 enum
 {
@@ -394,7 +399,8 @@ status_t LPUART_Init(LPUART_Type *base, const lpuart_config_t *config, uint32_t
 /*!
  * @brief Deinitializes a LPUART instance.
  *
- * This function waits for transmit to complete, disables TX and RX, and disables the LPUART clock.
+ * This function waits for transmit to complete, disables TX and RX, and releases the LPUART clock reference
+ * taken by LPUART_Init(). The clock is gated with its last reference.
  *
  * @param base LPUART peripheral base address.
  */
@@ -266,6 +266,14 @@ typedef struct _port_pin_config
     uint16_t : 1;
 #endif /* FSL_FEATURE_PORT_HAS_PIN_CONTROL_LOCK */
 } port_pin_config_t;
+
+/*! @brief Pins of one port sharing a PCR configuration, see PORT_SetPinGroupsConfig(). */
+typedef struct _port_pin_group
+{
+    PORT_Type *base;          /*!< PORT peripheral base pointer. */
+    uint32_t mask;            /*!< Pins of the group, bit n for pin n. */
+    port_pin_config_t config; /*!< PCR configuration of all pins of the group. */
+} port_pin_group_t;
 #endif /* FSL_FEATURE_PORT_PCR_MUX_WIDTH */
 
 #if defined(FSL_FEATURE_PORT_HAS_VERSION_INFO_REGISTER) && FSL_FEATURE_PORT_HAS_VERSION_INFO_REGISTER
@@ -397,6 +405,26 @@ static inline void PORT_SetMultiplePinsConfig(PORT_Type *base, uint32_t mask, co
     }
 }
 
+/*!
+ * @brief Sets the port PCR registers from a table of pin groups.
+ *
+ * Pins with the same configuration are grouped, so each group takes at most one GPCLR and one
+ * GPCHR write whatever its number of pins.
+ *
+ * @param groups Pin groups.
+ * @param count  Number of groups.
+ */
+static inline void PORT_SetPinGroupsConfig(const port_pin_group_t *groups, uint32_t count)
+{
+    assert(groups);
+
+    for (; count != 0U; count--)
+    {
+        PORT_SetMultiplePinsConfig(groups->base, groups->mask, &groups->config);
+        groups++;
+    }
+}
+
 #if defined(FSL_FEATURE_PORT_HAS_MULTIPLE_IRQ_CONFIG) && FSL_FEATURE_PORT_HAS_MULTIPLE_IRQ_CONFIG
 /*!
  * @brief Sets the port interrupt configuration in PCR register for multiple pins.
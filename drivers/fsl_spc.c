@@ -26,10 +26,12 @@
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
+static status_t SPC_CheckRegulatorTransaction(SPC_Type *base, uint32_t activeCfg, uint32_t lpCfg, bool checkLowPower);
 
 /*******************************************************************************
  * Variables
  ******************************************************************************/
+static spc_busy_wait_record_t s_spcBusyWaitRecord;
 
 /*******************************************************************************
  * Code
@@ -53,6 +55,72 @@ spc_power_domain_low_power_mode_t SPC_GetPowerDomainLowPowerMode(SPC_Type *base,
     return (spc_power_domain_low_power_mode_t)val;
 }
 
+/*!
+ * brief Waits for the SPC busy flag to clear, polling at a fixed period.
+ *
+ * param base SPC peripheral base address.
+ * retval kStatus_Success The SPC is not busy.
+ * retval kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
+ */
+status_t SPC_WaitBusyStatusFlagClear(SPC_Type *base)
+{
+    uint32_t traceState;
+    uint32_t start;
+    uint32_t spinCycles;
+    uint32_t elapsedUs;
+    uint32_t polls    = 0U;
+    uint32_t coreFreq = CLOCK_GetCoreSysClkFreq();
+    status_t status   = kStatus_Success;
+
+    traceState = SDK_TraceState((uint32_t)kSDK_TraceStateSpcBusyWait);
+
+    /* Spin for the first poll period, the cycle counter gives the exact latency of short changes. */
+    spinCycles = (uint32_t)USEC_TO_COUNT(SPC_BUSY_WAIT_POLL_US, coreFreq);
+    MSDK_EnableCpuCycleCounter();
+    start = MSDK_GetCpuCycleCount();
+    while (((base->SC & SPC_SC_BUSY_MASK) != 0UL) && ((MSDK_GetCpuCycleCount() - start) < spinCycles))
+    {
+    }
+    elapsedUs = (uint32_t)COUNT_TO_USEC(MSDK_GetCpuCycleCount() - start, coreFreq);
+
+    /* Then poll every period, asleep only if SDK_DelaySleep() is overridden. */
+    while ((base->SC & SPC_SC_BUSY_MASK) != 0UL)
+    {
+        if (polls >= (SPC_BUSY_WAIT_TIMEOUT_US / SPC_BUSY_WAIT_POLL_US))
+        {
+            status = kStatus_Timeout;
+            break;
+        }
+        SDK_DelayAtLeastUs(SPC_BUSY_WAIT_POLL_US, coreFreq);
+        polls++;
+    }
+    elapsedUs += polls * SPC_BUSY_WAIT_POLL_US;
+
+    (void)SDK_TraceState(traceState);
+
+    s_spcBusyWaitRecord.count++;
+    s_spcBusyWaitRecord.lastUs = elapsedUs;
+    s_spcBusyWaitRecord.maxUs  = MAX(s_spcBusyWaitRecord.maxUs, elapsedUs);
+    if (status != kStatus_Success)
+    {
+        s_spcBusyWaitRecord.timeouts++;
+    }
+
+    return status;
+}
+
+/*!
+ * brief Gets the latency record of the SPC busy waits.
+ *
+ * param record Copy of the record.
+ */
+void SPC_GetBusyWaitRecord(spc_busy_wait_record_t *record)
+{
+    assert(record != NULL);
+
+    *record = s_spcBusyWaitRecord;
+}
+
 /*!
  * brief Gets Isolation status for each power domains.
  *
@@ -801,6 +869,7 @@ void SPC_SetExternalVoltageDomainsConfig(SPC_Type *base, uint8_t lowPowerIsoMask
  *
  * retval kStatus_Success Config Core LDO regulator in Active power mode successful.
  * retval kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * retval kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
  * retval kStatus_SPC_CORELDOLowDriveStrengthIgnore If any voltage detect enabled, core_ldo's drive strength can not
  * set to low.
  * retval kStatus_SPC_CORELDOVoltageWrong The selected voltage level in active mode is not allowed.
@@ -844,11 +913,7 @@ status_t SPC_SetActiveModeCoreLDORegulatorConfig(SPC_Type *base, const spc_activ
      * $Branch Coverage Justification$
      * $ref spc_c_ref_1$.
      */
-    while ((base->SC & SPC_SC_BUSY_MASK) != 0UL)
-    {
-    }
-
-    return kStatus_Success;
+    return SPC_WaitBusyStatusFlagClear(base);
 }
 
 /*!
@@ -926,6 +991,7 @@ status_t SPC_SetActiveModeCoreLDORegulatorDriveStrength(SPC_Type *base, spc_core
  * param option Pointer to the spc_lowpower_mode_Core_LDO_option_t structure.
  * retval kStatus_Success Config Core LDO regulator in power mode successfully.
  * retval kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * retval kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
  * retval kStatus_SPC_BandgapModeWrong The bandgap mode setting in low powermode is wrong.
  * retval kStatus_SPC_CORELDOVoltageWrong The selected voltage level is wrong.
  * retval kStatus_SPC_CORELDOLowDriveStrengthIgnore Set driver strength to low will be ignored.
@@ -971,8 +1037,9 @@ status_t SPC_SetLowPowerModeCoreLDORegulatorConfig(SPC_Type *base, const spc_low
      * $Branch Coverage Justification$
      * $ref spc_c_ref_1$.
      */
-    while ((base->SC & SPC_SC_BUSY_MASK) != 0UL)
+    if (SPC_WaitBusyStatusFlagClear(base) != kStatus_Success)
     {
+        status = kStatus_Timeout;
     }
 
     return status;
@@ -1050,6 +1117,234 @@ status_t SPC_SetLowPowerModeCoreLDORegulatorDriveStrength(SPC_Type *base, spc_co
     return kStatus_Success;
 }
 
+/* Checks the register values a transaction commits with the rules of the single setters. */
+static status_t SPC_CheckRegulatorTransaction(SPC_Type *base, uint32_t activeCfg, uint32_t lpCfg, bool checkLowPower)
+{
+    uint32_t activeLevel = activeCfg & SPC_ACTIVE_CFG_CORELDO_VDD_LVL_MASK;
+    uint32_t activeDS    = SPC_ACTIVE_CFG_CORELDO_VDD_DS(kSPC_CoreLDO_NormalDriveStrength);
+    uint32_t lpDS        = lpCfg & SPC_LP_CFG_CORELDO_VDD_DS_MASK;
+    bool lpBandgapOff    = ((lpCfg & SPC_LP_CFG_BGMODE_MASK) == SPC_LP_CFG_BGMODE(kSPC_BandgapDisabled));
+
+#if defined(FSL_FEATURE_SPC_HAS_CORELDO_VDD_DS) && FSL_FEATURE_SPC_HAS_CORELDO_VDD_DS
+    activeDS = activeCfg & SPC_ACTIVE_CFG_CORELDO_VDD_DS_MASK;
+    if (activeDS == SPC_ACTIVE_CFG_CORELDO_VDD_DS(kSPC_CoreLDO_LowDriveStrength))
+    {
+        if (SPC_GetActiveModeVoltageDetectStatus(base) != 0UL)
+        {
+            return kStatus_SPC_CORELDOLowDriveStrengthIgnore;
+        }
+        /* The voltage level only changes with a normal drive strength. */
+        if ((SPC_GetActiveModeCoreLDODriveStrength(base) == kSPC_CoreLDO_LowDriveStrength) &&
+            (activeLevel != (base->ACTIVE_CFG & SPC_ACTIVE_CFG_CORELDO_VDD_LVL_MASK)))
+        {
+            return kStatus_SPC_CORELDOVoltageWrong;
+        }
+    }
+    else if (SPC_GetActiveModeBandgapMode(base) == kSPC_BandgapDisabled)
+    {
+        return kStatus_SPC_BandgapModeWrong;
+    }
+    else
+    {
+        /* Normal drive strength with the bandgap enabled. */
+    }
+#endif /* FSL_FEATURE_SPC_HAS_CORELDO_VDD_DS */
+
+    if (!checkLowPower)
+    {
+        return kStatus_Success;
+    }
+
+    if (lpDS == SPC_LP_CFG_CORELDO_VDD_DS(kSPC_CoreLDO_LowDriveStrength))
+    {
+        if (SPC_GetLowPowerModeVoltageDetectStatus(base) != 0UL)
+        {
+            return kStatus_SPC_CORELDOLowDriveStrengthIgnore;
+        }
+    }
+    else if (lpBandgapOff)
+    {
+        return kStatus_SPC_BandgapModeWrong;
+    }
+    else
+    {
+        /* Normal drive strength with the bandgap enabled. */
+    }
+
+    /* With the bandgap off, no LVD/HVD can stay enabled and GLITCH_DETECT_DISABLE must be set. */
+    if (lpBandgapOff && ((SPC_GetLowPowerModeVoltageDetectStatus(base) != 0UL) ||
+                         ((lpCfg & SPC_LP_CFG_GLITCH_DETECT_DISABLE_MASK) == 0UL)))
+    {
+        return kStatus_SPC_BandgapModeWrong;
+    }
+
+    /* ACTIVE_CFG and LP_CFG share the CORELDO_VDD_LVL and CORELDO_VDD_DS positions. */
+    if (((lpDS == activeDS) || (lpDS == SPC_LP_CFG_CORELDO_VDD_DS(kSPC_CoreLDO_NormalDriveStrength))) &&
+        ((lpCfg & SPC_LP_CFG_CORELDO_VDD_LVL_MASK) != activeLevel))
+    {
+        return kStatus_SPC_CORELDOVoltageWrong;
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Commits a regulator transaction.
+ *
+ * param base SPC peripheral base address.
+ * param transaction Staged changes.
+ * retval kStatus_Success The staged state is applied.
+ * retval kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * retval kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
+ * retval kStatus_SPC_CORELDOVoltageWrong The selected voltage levels are not allowed.
+ * retval kStatus_SPC_CORELDOLowDriveStrengthIgnore A low drive strength with voltage detects enabled.
+ * retval kStatus_SPC_BandgapModeWrong A normal drive strength or voltage detects with the bandgap disabled.
+ */
+status_t SPC_CommitRegulatorTransaction(SPC_Type *base, const spc_regulator_transaction_t *transaction)
+{
+    spc_regulator_transaction_t commit;
+    status_t status;
+
+    assert(transaction != NULL);
+
+    commit = *transaction;
+    status = SPC_StartRegulatorTransaction(base, &commit);
+    if ((status == kStatus_Success) && commit.settling)
+    {
+        /*
+         * $Branch Coverage Justification$
+         * $ref spc_c_ref_1$.
+         */
+        status = SPC_WaitBusyStatusFlagClear(base);
+    }
+    /* Not above a voltage the regulator has not reached. */
+    if (status == kStatus_Success)
+    {
+        status = SPC_FinishRegulatorTransaction(base, &commit);
+    }
+
+    return status;
+}
+
+/*!
+ * brief Starts the commit of a regulator transaction, without waiting for the regulators to settle.
+ *
+ * param base SPC peripheral base address.
+ * param transaction Staged changes, keeps the state of the commit.
+ * retval kStatus_Success The regulator changes are started, or there were none.
+ * retval kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * retval kStatus_SPC_CORELDOVoltageWrong The selected voltage levels are not allowed.
+ * retval kStatus_SPC_CORELDOLowDriveStrengthIgnore A low drive strength with voltage detects enabled.
+ * retval kStatus_SPC_BandgapModeWrong A normal drive strength or voltage detects with the bandgap disabled.
+ */
+status_t SPC_StartRegulatorTransaction(SPC_Type *base, spc_regulator_transaction_t *transaction)
+{
+    spc_sram_voltage_config_t sramOption;
+    uint32_t currentActive;
+    uint32_t activeCfg;
+    uint32_t stepCfg;
+    uint32_t lpCfg;
+    bool sramUpdate;
+    bool raise;
+    status_t status;
+
+    assert(transaction != NULL);
+
+    transaction->settling    = false;
+    transaction->sramPending = false;
+
+    if ((base->SC & SPC_SC_BUSY_MASK) != 0UL)
+    {
+        return kStatus_SPC_Busy;
+    }
+
+    currentActive = base->ACTIVE_CFG;
+    activeCfg     = (currentActive & ~transaction->activeMask) | transaction->activeCfg;
+    lpCfg         = (base->LP_CFG & ~transaction->lpMask) | transaction->lpCfg;
+    sramUpdate    = ((base->SRAMCTL & transaction->sramMask) != transaction->sramCtl);
+
+    status = SPC_CheckRegulatorTransaction(base, activeCfg, lpCfg, (transaction->lpMask != 0UL));
+    if (status != kStatus_Success)
+    {
+        return status;
+    }
+
+    raise = ((activeCfg & SPC_ACTIVE_CFG_CORELDO_VDD_LVL_MASK) > (currentActive & SPC_ACTIVE_CFG_CORELDO_VDD_LVL_MASK));
+
+    /* The SRAM margin follows the lower voltage first, and the higher voltage last. */
+    if (sramUpdate && !raise)
+    {
+        sramOption.operateVoltage =
+            (spc_sram_operate_voltage_t)(uint32_t)((transaction->sramCtl & SPC_SRAMCTL_VSM_MASK) >> SPC_SRAMCTL_VSM_SHIFT);
+        sramOption.requestVoltageUpdate = true;
+        SPC_SetSRAMOperateVoltage(base, &sramOption);
+    }
+    transaction->sramPending = (sramUpdate && raise);
+
+    if (activeCfg != currentActive)
+    {
+        stepCfg = currentActive;
+#if defined(FSL_FEATURE_SPC_HAS_CORELDO_VDD_DS) && FSL_FEATURE_SPC_HAS_CORELDO_VDD_DS
+        if ((activeCfg & SPC_ACTIVE_CFG_CORELDO_VDD_DS_MASK) != (currentActive & SPC_ACTIVE_CFG_CORELDO_VDD_DS_MASK))
+        {
+            /* Normal drive strength before a voltage change, low drive strength after it. */
+            stepCfg = ((activeCfg & SPC_ACTIVE_CFG_CORELDO_VDD_DS_MASK) ==
+                       SPC_ACTIVE_CFG_CORELDO_VDD_DS(kSPC_CoreLDO_NormalDriveStrength)) ?
+                          ((currentActive & ~SPC_ACTIVE_CFG_CORELDO_VDD_DS_MASK) |
+                           (activeCfg & SPC_ACTIVE_CFG_CORELDO_VDD_DS_MASK)) :
+                          ((currentActive & ~SPC_ACTIVE_CFG_CORELDO_VDD_LVL_MASK) |
+                           (activeCfg & SPC_ACTIVE_CFG_CORELDO_VDD_LVL_MASK));
+        }
+#endif /* FSL_FEATURE_SPC_HAS_CORELDO_VDD_DS */
+        if ((stepCfg != currentActive) && (stepCfg != activeCfg))
+        {
+            base->ACTIVE_CFG = stepCfg;
+        }
+        base->ACTIVE_CFG      = activeCfg;
+        transaction->settling = true;
+    }
+
+    /* Only used at the next low power mode entry, no settling. */
+    if (lpCfg != base->LP_CFG)
+    {
+        base->LP_CFG = lpCfg;
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Completes a regulator transaction started by SPC_StartRegulatorTransaction(), does not wait.
+ *
+ * param base SPC peripheral base address.
+ * param transaction Transaction started by SPC_StartRegulatorTransaction().
+ * retval kStatus_Success The regulators have settled and the transaction is complete.
+ * retval kStatus_SPC_Busy The regulators are still settling, call again later.
+ */
+status_t SPC_FinishRegulatorTransaction(SPC_Type *base, spc_regulator_transaction_t *transaction)
+{
+    spc_sram_voltage_config_t sramOption;
+
+    assert(transaction != NULL);
+
+    if ((base->SC & SPC_SC_BUSY_MASK) != 0UL)
+    {
+        return kStatus_SPC_Busy;
+    }
+    transaction->settling = false;
+
+    if (transaction->sramPending)
+    {
+        sramOption.operateVoltage =
+            (spc_sram_operate_voltage_t)(uint32_t)((transaction->sramCtl & SPC_SRAMCTL_VSM_MASK) >> SPC_SRAMCTL_VSM_SHIFT);
+        sramOption.requestVoltageUpdate = true;
+        SPC_SetSRAMOperateVoltage(base, &sramOption);
+        transaction->sramPending = false;
+    }
+
+    return kStatus_Success;
+}
+
 #if (defined(FSL_FEATURE_MCX_SPC_HAS_SYS_LDO) && FSL_FEATURE_MCX_SPC_HAS_SYS_LDO)
 /*!
  * brief Configs System LDO VDD Regulator in Active mode.
@@ -1068,6 +1363,7 @@ status_t SPC_SetLowPowerModeCoreLDORegulatorDriveStrength(SPC_Type *base, spc_co
  * param option Pointer to the spc_active_mode_Sys_LDO_option_t structure.
  * retval kStatus_Success Config System LDO regulator in Active power mode successful.
  * retval kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * retval kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
  * retval kStatus_SPC_BandgapModeWrong The bandgap mode setting in Active mode is wrong.
  * retval kStatus_SPC_SYSLDOOverDriveVoltageFail Fail to regulator to Over Drive Voltage.
  * retval kStatus_SPC_SYSLDOLowDriveStrengthIgnore Set System LDO VDD regulator's driver strength to Low will be
@@ -1098,8 +1394,9 @@ status_t SPC_SetActiveModeSystemLDORegulatorConfig(SPC_Type *base, const spc_act
      * $Branch Coverage Justification$
      * $ref spc_c_ref_1$.
      */
-    while ((base->SC & SPC_SC_BUSY_MASK) != 0UL)
+    if (SPC_WaitBusyStatusFlagClear(base) != kStatus_Success)
     {
+        status = kStatus_Timeout;
     }
 
     return status;
@@ -1184,6 +1481,7 @@ status_t SPC_SetActiveModeSystemLDORegulatorDriveStrength(SPC_Type *base, spc_sy
  * param option Pointer to spc_lowpower_mode_Sys_LDO_option_t structure.
  * retval kStatus_Success Config System LDO regulator in Low Power Mode successfully.
  * retval kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * retval kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
  * retval kStatus_SPC_BandgapModeWrong The bandgap mode setting in Low Power Mode is wrong.
  * retval kStatus_SPC_SYSLDOLowDriveStrengthIgnore Set driver strength to low will be ignored.
  */
@@ -1205,8 +1503,9 @@ status_t SPC_SetLowPowerModeSystemLDORegulatorConfig(SPC_Type *base, const spc_l
      * $Branch Coverage Justification$
      * $ref spc_c_ref_1$.
      */
-    while ((base->SC & SPC_SC_BUSY_MASK) != 0UL)
+    if (SPC_WaitBusyStatusFlagClear(base) != kStatus_Success)
     {
+        status = kStatus_Timeout;
     }
 
     return status;
@@ -1260,6 +1559,7 @@ status_t SPC_SetLowPowerModeSystemLDORegulatorDriveStrength(SPC_Type *base, spc_
  * param option Pointer to the spc_active_mode_DCDC_option_t structure.
  * retval kStatus_Success Config DCDC regulator in Active power mode successful.
  * retval kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * retval kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
  * retval kStatus_SPC_BandgapModeWrong The bandgap mode setting in Active mode is wrong.
  * retval kStatus_SPC_DCDCLowDriveStrengthIgnore Set driver strength to Low will be ignored.
  */
@@ -1288,8 +1588,9 @@ status_t SPC_SetActiveModeDCDCRegulatorConfig(SPC_Type *base, const spc_active_m
      * $Branch Coverage Justification$
      * $ref spc_c_ref_1$.
      */
-    while ((base->SC & SPC_SC_BUSY_MASK) != 0UL)
+    if (SPC_WaitBusyStatusFlagClear(base) != kStatus_Success)
     {
+        status = kStatus_Timeout;
     }
 
     return status;
@@ -1346,6 +1647,7 @@ status_t SPC_SetActiveModeDCDCRegulatorDriveStrength(SPC_Type *base, spc_dcdc_dr
  * param option Pointer to the spc_lowpower_mode_DCDC_option_t structure.
  * retval kStatus_Success Config DCDC regulator in low power mode successfully.
  * retval kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * retval kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
  * retval kStatus_SPC_BandgapModeWrong The bandgap mode setting in Low Power mode is wrong.
  * retval kStatus_SPC_DCDCPulseRefreshModeIgnore Set driver strength to Pulse Refresh mode will be ignored.
  * retval kStatus_SPC_DCDCLowDriveStrengthIgnore Set driver strength to Low Drive Strength will be ignored.
@@ -1373,8 +1675,9 @@ status_t SPC_SetLowPowerModeDCDCRegulatorConfig(SPC_Type *base, const spc_lowpow
      * $Branch Coverage Justification$
      * $ref spc_c_ref_1$.
      */
-    while ((base->SC & SPC_SC_BUSY_MASK) != 0UL)
+    if (SPC_WaitBusyStatusFlagClear(base) != kStatus_Success)
     {
+        status = kStatus_Timeout;
     }
 
     return status;
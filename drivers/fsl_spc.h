@@ -47,6 +47,16 @@
 #define SPC_VDD_CORE_GLITCH_DETECT_SC_IE                         SPC_GLITCH_DETECT_SC_IE
 #endif 
 
+/*! @brief Longest wait for the SPC busy flag to clear, in microseconds. */
+#ifndef SPC_BUSY_WAIT_TIMEOUT_US
+#define SPC_BUSY_WAIT_TIMEOUT_US (5000U)
+#endif
+
+/*! @brief Time the core sleeps between two polls of the SPC busy flag, in microseconds. */
+#ifndef SPC_BUSY_WAIT_POLL_US
+#define SPC_BUSY_WAIT_POLL_US (20U)
+#endif
+
 /*!
  * @brief SPC status enumeration.
  *
@@ -474,6 +484,34 @@ typedef struct _spc_lowpower_mode_regulators_config
     spc_lowpower_mode_core_ldo_option_t CoreLDOOption; /*!< Specify core LDO configurations in low power modes. */
 } spc_lowpower_mode_regulators_config_t;
 
+/*!
+ * @brief Latency record of the SPC busy waits.
+ */
+typedef struct _spc_busy_wait_record
+{
+    uint32_t count;      /*!< Busy waits, including the ones that found the SPC idle. */
+    uint32_t timeouts;   /*!< Busy waits that ran into SPC_BUSY_WAIT_TIMEOUT_US. */
+    uint32_t lastUs;     /*!< Duration of the last busy wait, in microseconds. */
+    uint32_t maxUs;      /*!< Duration of the longest busy wait, in microseconds. */
+} spc_busy_wait_record_t;
+
+/*!
+ * @brief Regulator changes staged by the SPC_Stage functions, committed by SPC_CommitRegulatorTransaction().
+ *
+ * Holds only the staged fields, the other register fields keep their value at commit time.
+ */
+typedef struct _spc_regulator_transaction
+{
+    uint32_t activeCfg;  /*!< Staged ACTIVE_CFG fields. */
+    uint32_t activeMask; /*!< ACTIVE_CFG fields staged. */
+    uint32_t lpCfg;      /*!< Staged LP_CFG fields. */
+    uint32_t lpMask;     /*!< LP_CFG fields staged. */
+    uint32_t sramCtl;    /*!< Staged SRAMCTL VSM field. */
+    uint32_t sramMask;   /*!< SRAMCTL fields staged. */
+    bool settling;       /*!< Set by SPC_StartRegulatorTransaction() when ACTIVE_CFG changed. */
+    bool sramPending;    /*!< SRAM voltage update left for SPC_FinishRegulatorTransaction(). */
+} spc_regulator_transaction_t;
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -531,6 +569,29 @@ static inline bool SPC_GetBusyStatusFlag(SPC_Type *base)
     return ((base->SC & SPC_SC_BUSY_MASK) != 0UL);
 }
 
+/*!
+ * @brief Waits for the SPC busy flag to clear, polling at a fixed period.
+ *
+ * The SPC has no interrupt for the end of a regulator change. Most changes complete within a few
+ * microseconds, so the flag is first polled for SPC_BUSY_WAIT_POLL_US, timed with the DWT cycle counter.
+ * After that it is polled every SPC_BUSY_WAIT_POLL_US through SDK_DelayAtLeastUs(). The core only sleeps
+ * between these polls when the application overrides SDK_DelaySleep(), the weak default spins. Gives up after
+ * SPC_BUSY_WAIT_TIMEOUT_US. The wait is recorded in the busy wait record, the time after the first poll
+ * period counts in whole poll periods, the cycle counter stops while the core sleeps.
+ *
+ * @param base SPC peripheral base address.
+ * @retval kStatus_Success The SPC is not busy.
+ * @retval kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
+ */
+status_t SPC_WaitBusyStatusFlagClear(SPC_Type *base);
+
+/*!
+ * @brief Gets the latency record of the SPC busy waits.
+ *
+ * @param record Copy of the record.
+ */
+void SPC_GetBusyWaitRecord(spc_busy_wait_record_t *record);
+
 /*!
  * @brief Checks system low power request.
  *
@@ -1722,6 +1783,7 @@ static inline void SPC_PullDownCoreLDORegulator(SPC_Type *base, bool pulldown)
  *
  * @retval #kStatus_Success Config Core LDO regulator in Active power mode successful.
  * @retval #kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * @retval #kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
  * @retval #kStatus_SPC_CORELDOLowDriveStrengthIgnore If any voltage detect enabled, core_ldo's drive strength can not
  * set to low.
  * @retval #kStatus_SPC_CORELDOVoltageWrong The selected voltage level in active mode is not allowed.
@@ -1800,6 +1862,7 @@ static inline spc_core_ldo_drive_strength_t SPC_GetActiveModeCoreLDODriveStrengt
  *
  * @retval #kStatus_Success Config Core LDO regulator in power mode successfully.
  * @retval #kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * @retval #kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
  * @retval #kStatus_SPC_CORELDOLowDriveStrengthIgnore Set driver strength to low will be ignored.
  * @retval #kStatus_SPC_CORELDOVoltageSetFail. Fail to change Core LDO voltage level.
  */
@@ -1860,6 +1923,156 @@ static inline spc_core_ldo_drive_strength_t SPC_GetLowPowerCoreLDOVDDDriveStreng
                                                      SPC_LP_CFG_CORELDO_VDD_DS_SHIFT);
 }
 
+/*!
+ * @name Regulator transaction
+ * @{
+ */
+
+/*!
+ * @brief Starts a regulator transaction, with nothing staged.
+ *
+ * A transaction replaces a series of SPC_SetXxxRegulatorConfig(), SPC_SetLowPowerModeBandgapmodeConfig() and
+ * SPC_SetSRAMOperateVoltage() calls, each with its own busy wait, by one ordered commit with a single one.
+ *
+ * @param transaction Transaction to start.
+ */
+static inline void SPC_BeginRegulatorTransaction(spc_regulator_transaction_t *transaction)
+{
+    (void)memset(transaction, 0, sizeof(*transaction));
+}
+
+/*!
+ * @brief Stages the CORE LDO configuration of Active mode.
+ *
+ * @param transaction Transaction to stage the change in.
+ * @param option Pointer to the spc_active_mode_core_ldo_option_t structure.
+ */
+static inline void SPC_StageActiveModeCoreLDORegulatorConfig(spc_regulator_transaction_t *transaction,
+                                                             const spc_active_mode_core_ldo_option_t *option)
+{
+    transaction->activeCfg = (transaction->activeCfg & ~SPC_ACTIVE_CFG_CORELDO_VDD_LVL_MASK) |
+                             SPC_ACTIVE_CFG_CORELDO_VDD_LVL(option->CoreLDOVoltage);
+    transaction->activeMask |= SPC_ACTIVE_CFG_CORELDO_VDD_LVL_MASK;
+#if defined(FSL_FEATURE_SPC_HAS_CORELDO_VDD_DS) && FSL_FEATURE_SPC_HAS_CORELDO_VDD_DS
+    transaction->activeCfg = (transaction->activeCfg & ~SPC_ACTIVE_CFG_CORELDO_VDD_DS_MASK) |
+                             SPC_ACTIVE_CFG_CORELDO_VDD_DS(option->CoreLDODriveStrength);
+    transaction->activeMask |= SPC_ACTIVE_CFG_CORELDO_VDD_DS_MASK;
+#endif /* FSL_FEATURE_SPC_HAS_CORELDO_VDD_DS */
+}
+
+/*!
+ * @brief Stages the CORE LDO configuration of Low Power mode.
+ *
+ * @param transaction Transaction to stage the change in.
+ * @param option Pointer to the spc_lowpower_mode_core_ldo_option_t structure.
+ */
+static inline void SPC_StageLowPowerModeCoreLDORegulatorConfig(spc_regulator_transaction_t *transaction,
+                                                               const spc_lowpower_mode_core_ldo_option_t *option)
+{
+    transaction->lpCfg = (transaction->lpCfg & ~(SPC_LP_CFG_CORELDO_VDD_LVL_MASK | SPC_LP_CFG_CORELDO_VDD_DS_MASK)) |
+                         SPC_LP_CFG_CORELDO_VDD_LVL(option->CoreLDOVoltage) |
+                         SPC_LP_CFG_CORELDO_VDD_DS(option->CoreLDODriveStrength);
+    transaction->lpMask |= SPC_LP_CFG_CORELDO_VDD_LVL_MASK | SPC_LP_CFG_CORELDO_VDD_DS_MASK;
+}
+
+/*!
+ * @brief Stages the Bandgap mode of Low Power mode.
+ *
+ * @param transaction Transaction to stage the change in.
+ * @param mode The Bandgap mode be selected.
+ */
+static inline void SPC_StageLowPowerModeBandgapmodeConfig(spc_regulator_transaction_t *transaction,
+                                                          spc_bandgap_mode_t mode)
+{
+    transaction->lpCfg = (transaction->lpCfg & ~SPC_LP_CFG_BGMODE_MASK) | SPC_LP_CFG_BGMODE(mode);
+    transaction->lpMask |= SPC_LP_CFG_BGMODE_MASK;
+}
+
+/*!
+ * @brief Stages the VDD Core Glitch Detect disable of Low Power mode.
+ *
+ * @note A disabled low power bandgap requires the glitch detect to be disabled.
+ *
+ * @param transaction Transaction to stage the change in.
+ * @param disable Used to disable/enable VDD Core Glitch detect feature.
+ */
+static inline void SPC_StageDisableLowPowerModeVddCoreGlitchDetect(spc_regulator_transaction_t *transaction,
+                                                                   bool disable)
+{
+    transaction->lpCfg = (transaction->lpCfg & ~SPC_LP_CFG_GLITCH_DETECT_DISABLE_MASK) |
+                         SPC_LP_CFG_GLITCH_DETECT_DISABLE(disable ? 1U : 0U);
+    transaction->lpMask |= SPC_LP_CFG_GLITCH_DETECT_DISABLE_MASK;
+}
+
+/*!
+ * @brief Stages the SRAM operate voltage, committed with a voltage update request.
+ *
+ * @param transaction Transaction to stage the change in.
+ * @param operateVoltage Operating voltage for the SRAM's read/write timing margin.
+ */
+static inline void SPC_StageSRAMOperateVoltage(spc_regulator_transaction_t *transaction,
+                                               spc_sram_operate_voltage_t operateVoltage)
+{
+    transaction->sramCtl  = SPC_SRAMCTL_VSM(operateVoltage);
+    transaction->sramMask = SPC_SRAMCTL_VSM_MASK;
+}
+
+/*!
+ * @brief Commits a regulator transaction.
+ *
+ * The staged state is checked as a whole, with the rules of the single setters, before anything is written.
+ * Fields staged with their current value are not written. The updates are ordered for the direction of the
+ * Active mode voltage change:
+ *  - When the CORE LDO voltage drops, the SRAM operate voltage is updated first.
+ *  - The Active mode CORE LDO takes one ACTIVE_CFG write, or two when its drive strength changes: the drive
+ *    strength goes normal before a voltage change, and low after it.
+ *  - LP_CFG takes one write, it only takes effect at the next low power mode entry.
+ *  - When the CORE LDO voltage rises, the SRAM operate voltage is updated once the regulator has settled.
+ * The SPC busy flag is waited for once, only when ACTIVE_CFG changes.
+ *
+ * @param base SPC peripheral base address.
+ * @param transaction Staged changes.
+ * @retval #kStatus_Success The staged state is applied.
+ * @retval #kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * @retval #kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
+ * @retval #kStatus_SPC_CORELDOVoltageWrong The Active mode voltage changes with a low drive strength, or the Low
+ *          Power mode voltage differs from the Active mode one with the same or normal drive strength.
+ * @retval #kStatus_SPC_CORELDOLowDriveStrengthIgnore A low drive strength with voltage detects enabled.
+ * @retval #kStatus_SPC_BandgapModeWrong A normal drive strength, voltage detects or the glitch detect with the bandgap
+ *          disabled.
+ */
+status_t SPC_CommitRegulatorTransaction(SPC_Type *base, const spc_regulator_transaction_t *transaction);
+
+/*!
+ * @brief Starts the commit of a regulator transaction, without waiting for the regulators to settle.
+ *
+ * Checks and writes like SPC_CommitRegulatorTransaction(), up to the ACTIVE_CFG and LP_CFG writes. The SRAM
+ * voltage update of a voltage rise is left for SPC_FinishRegulatorTransaction(). The caller keeps running at
+ * a frequency that is safe at both voltages until then.
+ *
+ * @param base SPC peripheral base address.
+ * @param transaction Staged changes, keeps the state of the commit.
+ * @retval #kStatus_Success The regulator changes are started, or there were none.
+ * @retval #kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * @retval #kStatus_SPC_CORELDOVoltageWrong The selected voltage levels are not allowed.
+ * @retval #kStatus_SPC_CORELDOLowDriveStrengthIgnore A low drive strength with voltage detects enabled.
+ * @retval #kStatus_SPC_BandgapModeWrong A normal drive strength, voltage detects or the glitch detect with the bandgap
+ *          disabled.
+ */
+status_t SPC_StartRegulatorTransaction(SPC_Type *base, spc_regulator_transaction_t *transaction);
+
+/*!
+ * @brief Completes a regulator transaction started by SPC_StartRegulatorTransaction(), does not wait.
+ *
+ * @param base SPC peripheral base address.
+ * @param transaction Transaction started by SPC_StartRegulatorTransaction().
+ * @retval #kStatus_Success The regulators have settled and the transaction is complete.
+ * @retval #kStatus_SPC_Busy The regulators are still settling, call again later.
+ */
+status_t SPC_FinishRegulatorTransaction(SPC_Type *base, spc_regulator_transaction_t *transaction);
+
+/* @} */
+
 #if (defined(FSL_FEATURE_MCX_SPC_HAS_SYS_LDO) && FSL_FEATURE_MCX_SPC_HAS_SYS_LDO)
 /*!
  * @name Set System LDO Regulator.
@@ -1930,6 +2143,7 @@ static inline void SPC_EnableSystemLDOSinkFeature(SPC_Type *base, bool sink)
  *
  * @retval #kStatus_Success Config System LDO regulator in Active power mode successful.
  * @retval #kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * @retval #kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
  * @retval #kStatus_SPC_SYSLDOOverDriveVoltageFail Fail to regulator to Over Drive Voltage.
  * @retval #kStatus_SPC_SYSLDOLowDriveStrengthIgnore Set driver strength to Low will be ignored.
  */
@@ -1999,6 +2213,7 @@ static inline spc_sys_ldo_drive_strength_t SPC_GetActiveModeSystemLDORegulatorDr
  *
  * @retval #kStatus_Success Config System LDO regulator in Low Power Mode successfully.
  * @retval #kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * @retval #kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
  * @retval #kStatus_SPC_SYSLDOLowDriveStrengthIgnore Set driver strength to low will be ignored.
  */
 status_t SPC_SetLowPowerModeSystemLDORegulatorConfig(SPC_Type *base, const spc_lowpower_mode_sys_ldo_option_t *option);
@@ -2092,6 +2307,7 @@ void SPC_SetDCDCRefreshCount(SPC_Type *base, uint16_t count);
  *
  * @retval #kStatus_Success Config DCDC regulator in Active power mode successful.
  * @retval #kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * @retval #kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
  * @retval #kStatus_SPC_DCDCLowDriveStrengthIgnore Set driver strength to Low will be ignored.
  */
 status_t SPC_SetActiveModeDCDCRegulatorConfig(SPC_Type *base, const spc_active_mode_dcdc_option_t *option);
@@ -2159,6 +2375,7 @@ static inline spc_dcdc_drive_strength_t SPC_GetActiveModeDCDCRegulatorDriveStren
  *
  * @retval #kStatus_Success Config DCDC regulator in low power mode successfully.
  * @retval #kStatus_SPC_Busy The SPC instance is busy to execute any type of power mode transition.
+ * @retval #kStatus_Timeout The SPC is still busy after SPC_BUSY_WAIT_TIMEOUT_US.
  * @retval #kStatus_SPC_DCDCPulseRefreshModeIgnore Set driver strength to Pulse Refresh mode will be ignored.
  * @retval #kStatus_SPC_DCDCLowDriveStrengthIgnore Set driver strength to Low Drive Strength will be ignored.
  */
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "clock_verify.h"
+#include "fsl_clock.h"
+#include "fsl_freqme.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define CLOCK_VERIFY_FREQME FREQME0
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint32_t CLOCK_VERIFY_GetExpectedFreq(clock_verify_target_t target);
+static uint32_t CLOCK_VERIFY_Abs(int32_t value);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static clock_verify_reference_t s_clockVerifyRef = kCLOCK_VERIFY_RefClk16K;
+/* 0 when the reference frequency comes from the clock driver. */
+static uint32_t s_clockVerifyRefFreq;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint32_t CLOCK_VERIFY_GetExpectedFreq(clock_verify_target_t target)
+{
+    uint32_t freq;
+
+    switch (target)
+    {
+        case kCLOCK_VERIFY_ClkIn:
+            freq = CLOCK_GetFreq(kCLOCK_ExtClk);
+            break;
+        case kCLOCK_VERIFY_Fro12M:
+            freq = CLOCK_GetFreq(kCLOCK_Fro12M);
+            break;
+        case kCLOCK_VERIFY_FroHfDiv:
+            freq = CLOCK_GetFreq(kCLOCK_FroHfDiv);
+            break;
+        default:
+            freq = 0U;
+            break;
+    }
+
+    return freq;
+}
+
+static uint32_t CLOCK_VERIFY_Abs(int32_t value)
+{
+    return (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value;
+}
+
+void CLOCK_VERIFY_Init(clock_verify_reference_t reference, uint32_t refFreq)
+{
+    s_clockVerifyRef     = reference;
+    s_clockVerifyRefFreq = refFreq;
+}
+
+status_t CLOCK_VERIFY_Measure(clock_verify_target_t target, uint8_t scale, clock_verify_result_t *result)
+{
+    freqme_config_t config;
+    uint32_t refFreq = s_clockVerifyRefFreq;
+    uint32_t start;
+    uint32_t timeout;
+    int64_t error;
+    status_t status = kStatus_Success;
+
+    assert(result != NULL);
+    assert(scale <= FREQME_MAX_REF_SCALE);
+
+    if (refFreq == 0U)
+    {
+        refFreq = (s_clockVerifyRef == kCLOCK_VERIFY_RefClk16K) ? CLOCK_GetFreq(kCLOCK_Clk16K1) :
+                  (s_clockVerifyRef == kCLOCK_VERIFY_RefClkIn)  ? CLOCK_GetFreq(kCLOCK_ExtClk) :
+                                                                  0U;
+    }
+    result->expectedHz = CLOCK_VERIFY_GetExpectedFreq(target);
+    result->measuredHz = 0U;
+    result->errorPpm   = 0;
+    if ((refFreq == 0U) || (result->expectedHz == 0U))
+    {
+        return kStatus_Fail;
+    }
+
+    /* Twice the window and the synchronization clocks: the measurement only overruns without a reference. */
+    timeout = (uint32_t)MIN((((1ULL << scale) + 2ULL) * 2ULL * CLOCK_GetCoreSysClkFreq()) / refFreq, 0xFFFFFFFFULL);
+
+    CLOCK_RequestClock(kCLOCK_GateINPUTMUX0);
+    INPUTMUX0->FREQMEAS_REF = INPUTMUX_FREQMEAS_REF_INP((uint32_t)s_clockVerifyRef);
+    INPUTMUX0->FREQMEAS_TAR = INPUTMUX_FREQMEAS_TAR_INP((uint32_t)target);
+    CLOCK_ReleaseClock(kCLOCK_GateINPUTMUX0);
+
+    FREQME_GetDefaultConfig(&config);
+    config.refClkScaleFactor = scale;
+    config.startMeasurement  = true;
+    FREQME_Init(CLOCK_VERIFY_FREQME, &config);
+
+    start = MSDK_GetCpuCycleCount();
+    while (FREQME_IsMeasurementInProgress(CLOCK_VERIFY_FREQME))
+    {
+        if ((MSDK_GetCpuCycleCount() - start) > timeout)
+        {
+            FREQME_TerminateMeasurementCycle(CLOCK_VERIFY_FREQME);
+            status = kStatus_Timeout;
+            break;
+        }
+    }
+
+    if (status == kStatus_Success)
+    {
+        result->measuredHz = FREQME_CalculateTargetClkFreq(CLOCK_VERIFY_FREQME, refFreq);
+        error              = ((int64_t)result->measuredHz - (int64_t)result->expectedHz) * 1000000LL;
+        result->errorPpm   = (int32_t)(error / (int64_t)result->expectedHz);
+    }
+
+    FREQME_Deinit(CLOCK_VERIFY_FREQME);
+
+    return status;
+}
+
+status_t CLOCK_VERIFY_WaitSettled(clock_verify_target_t target,
+                                  uint32_t tolerancePpm,
+                                  uint32_t maxSamples,
+                                  uint32_t startCycles,
+                                  clock_verify_settle_t *settle)
+{
+    status_t status = kStatus_Fail;
+
+    assert(settle != NULL);
+
+    (void)memset(settle, 0, sizeof(*settle));
+    while (settle->samples < maxSamples)
+    {
+        settle->samples++;
+        status = CLOCK_VERIFY_Measure(target, CLOCK_VERIFY_SETTLE_REF_SCALE, &settle->result);
+        if (status != kStatus_Success)
+        {
+            return status;
+        }
+        if (CLOCK_VERIFY_Abs(settle->result.errorPpm) <= tolerancePpm)
+        {
+            settle->cycles = MSDK_GetCpuCycleCount() - startCycles;
+            return kStatus_Success;
+        }
+        status = kStatus_Fail;
+    }
+
+    return status;
+}
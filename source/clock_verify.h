@@ -0,0 +1,143 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _CLOCK_VERIFY_H_
+#define _CLOCK_VERIFY_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup clock_verify
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Reference clock scale of a verification, the window is 2^scale reference clocks. */
+#ifndef CLOCK_VERIFY_REF_SCALE
+#define CLOCK_VERIFY_REF_SCALE (6U)
+#endif
+
+/*! @brief Reference clock scale of the settling samples, short so the settling time stays fine grained. */
+#ifndef CLOCK_VERIFY_SETTLE_REF_SCALE
+#define CLOCK_VERIFY_SETTLE_REF_SCALE (1U)
+#endif
+
+/*! @brief Largest error from the expected frequency before the oscillator is reported as drifted, in ppm. */
+#ifndef CLOCK_VERIFY_DRIFT_LIMIT_PPM
+#define CLOCK_VERIFY_DRIFT_LIMIT_PPM (10000U)
+#endif
+
+/*! @brief Measured clocks, values are the INPUTMUX FREQMEAS_TAR selections. */
+typedef enum _clock_verify_target
+{
+    kCLOCK_VERIFY_ClkIn    = 1U, /*!< CLK_IN, external clock. */
+    kCLOCK_VERIFY_Fro12M   = 2U, /*!< FRO12M. */
+    kCLOCK_VERIFY_FroHfDiv = 3U, /*!< FRO_HF_DIV, FRO_HF after its divider. */
+} clock_verify_target_t;
+
+/*! @brief Reference clocks, values are the INPUTMUX FREQMEAS_REF selections. */
+typedef enum _clock_verify_reference
+{
+    kCLOCK_VERIFY_RefClkIn  = 1U, /*!< CLK_IN, a crystal or an external reference. */
+    kCLOCK_VERIFY_RefClk16K = 5U, /*!< CLK_16K[1], FRO16K to the VDD_CORE domain. */
+    kCLOCK_VERIFY_RefPin0   = 7U, /*!< FREQME_CLK_IN0 pin. */
+    kCLOCK_VERIFY_RefPin1   = 8U, /*!< FREQME_CLK_IN1 pin. */
+} clock_verify_reference_t;
+
+/*! @brief Result of a verification. */
+typedef struct _clock_verify_result
+{
+    uint32_t measuredHz; /*!< Measured frequency. */
+    uint32_t expectedHz; /*!< Frequency reported by the clock driver. */
+    int32_t errorPpm;    /*!< Measured minus expected, in ppm of the expected frequency. */
+} clock_verify_result_t;
+
+/*! @brief Settling of a clock after wake up. */
+typedef struct _clock_verify_settle
+{
+    uint32_t cycles;              /*!< Core cycles from the start point to the first sample in tolerance. */
+    uint32_t samples;             /*!< Samples taken, the last one is in tolerance if settled. */
+    clock_verify_result_t result; /*!< Last sample. */
+} clock_verify_settle_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Selects the reference clock.
+ *
+ * The reference must be running during measurements, kCLOCK_VERIFY_RefClk16K needs CLK_16K[1]
+ * enabled with CLOCK_SetupFRO16KClocking().
+ *
+ * @param reference Reference clock.
+ * @param refFreq Reference frequency in Hz, 0 to take it from the clock driver. Only CLK_16K[1] and CLK_IN
+ *                are known to the clock driver.
+ */
+void CLOCK_VERIFY_Init(clock_verify_reference_t reference, uint32_t refFreq);
+
+/*!
+ * @brief Measures a clock and compares it with the frequency the clock driver expects.
+ *
+ * Busy waits for 2^scale reference clocks. The DWT cycle counter must be enabled.
+ *
+ * @param target Measured clock.
+ * @param scale Window of 2^scale reference clocks, the resolution is refFreq / 2^scale.
+ * @param result Result.
+ * @retval kStatus_Success Measured.
+ * @retval kStatus_Fail No reference frequency, or the clock driver expects the target to be off.
+ * @retval kStatus_Timeout The measurement did not complete, the reference is not running.
+ */
+status_t CLOCK_VERIFY_Measure(clock_verify_target_t target, uint8_t scale, clock_verify_result_t *result);
+
+/*!
+ * @brief Samples a clock until it is within tolerance, to time its settling after wake up.
+ *
+ * Each sample is a CLOCK_VERIFY_SETTLE_REF_SCALE measurement. The settling time counts from a cycle counter
+ * value taken by the caller, typically right after the low power mode exit.
+ *
+ * @param target Measured clock.
+ * @param tolerancePpm Largest error of a settled clock, in ppm.
+ * @param maxSamples Samples taken before giving up.
+ * @param startCycles MSDK_GetCpuCycleCount() value the settling time counts from.
+ * @param settle Settling time and last sample.
+ * @retval kStatus_Success The clock settled.
+ * @retval kStatus_Fail The clock did not settle within maxSamples samples.
+ * @retval kStatus_Timeout A measurement did not complete, the reference is not running.
+ */
+status_t CLOCK_VERIFY_WaitSettled(clock_verify_target_t target,
+                                  uint32_t tolerancePpm,
+                                  uint32_t maxSamples,
+                                  uint32_t startCycles,
+                                  clock_verify_settle_t *settle);
+
+/*!
+ * @brief Checks a result against CLOCK_VERIFY_DRIFT_LIMIT_PPM.
+ *
+ * @param result Result of CLOCK_VERIFY_Measure().
+ * @return true if the oscillator is off its expected frequency by more than the limit.
+ */
+static inline bool CLOCK_VERIFY_IsDrifted(const clock_verify_result_t *result)
+{
+    return ((result->errorPpm > (int32_t)CLOCK_VERIFY_DRIFT_LIMIT_PPM) ||
+            (result->errorPpm < -(int32_t)CLOCK_VERIFY_DRIFT_LIMIT_PPM));
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _CLOCK_VERIFY_H_ */
@@ -0,0 +1,321 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "cmd_tokenizer.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Marks the integer being parsed as not an integer. */
+#define CMD_BASE_INVALID (0U)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void CMD_TokenizerStartToken(cmd_tokenizer_t *tokenizer, uint8_t c);
+static void CMD_TokenizerAppend(cmd_tokenizer_t *tokenizer, uint8_t c);
+static void CMD_TokenizerEndToken(cmd_tokenizer_t *tokenizer);
+static void CMD_TokenizerResetLine(cmd_tokenizer_t *tokenizer);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void CMD_TokenizerStartToken(cmd_tokenizer_t *tokenizer, uint8_t c)
+{
+    cmd_token_t *token;
+
+    tokenizer->inToken = true;
+    if (tokenizer->count >= tokenizer->maxTokens)
+    {
+        /* Skip this and the remaining tokens of the line. */
+        tokenizer->truncated = true;
+        return;
+    }
+
+    token           = &tokenizer->tokens[tokenizer->count];
+    token->position = tokenizer->scan;
+    token->length   = 0U;
+    token->type     = (uint8_t)kCMD_TokenWord;
+    token->value    = 0;
+    tokenizer->count++;
+
+    tokenizer->negative  = (c == (uint8_t)'-');
+    tokenizer->digits    = 0U;
+    tokenizer->base      = 10U;
+    tokenizer->magnitude = 0U;
+    if ((c == (uint8_t)'-') || (c == (uint8_t)'+'))
+    {
+        token->length = 1U;
+    }
+    else
+    {
+        CMD_TokenizerAppend(tokenizer, c);
+    }
+}
+
+/* Extends the current token and accumulates its integer value in the same pass. */
+static void CMD_TokenizerAppend(cmd_tokenizer_t *tokenizer, uint8_t c)
+{
+    uint32_t digit;
+    uint64_t magnitude;
+
+    if (tokenizer->truncated)
+    {
+        return;
+    }
+
+    tokenizer->tokens[tokenizer->count - 1U].length++;
+
+    if (tokenizer->base == CMD_BASE_INVALID)
+    {
+        return;
+    }
+
+    if ((c >= (uint8_t)'0') && (c <= (uint8_t)'9'))
+    {
+        digit = (uint32_t)c - (uint32_t)'0';
+    }
+    else if ((tokenizer->base == 16U) && (c >= (uint8_t)'a') && (c <= (uint8_t)'f'))
+    {
+        digit = (uint32_t)c - (uint32_t)'a' + 10U;
+    }
+    else if ((tokenizer->base == 16U) && (c >= (uint8_t)'A') && (c <= (uint8_t)'F'))
+    {
+        digit = (uint32_t)c - (uint32_t)'A' + 10U;
+    }
+    else if (((c == (uint8_t)'x') || (c == (uint8_t)'X')) && (tokenizer->base == 10U) && (tokenizer->digits == 1U) &&
+             (tokenizer->magnitude == 0U) && !tokenizer->negative)
+    {
+        /* "0x" prefix, a hexadecimal value is a bit pattern and takes no minus sign. */
+        tokenizer->base   = 16U;
+        tokenizer->digits = 0U;
+        return;
+    }
+    else
+    {
+        tokenizer->base = CMD_BASE_INVALID;
+        return;
+    }
+
+    magnitude = ((uint64_t)tokenizer->magnitude * tokenizer->base) + digit;
+    /* Decimal must fit in int32_t, hexadecimal may use all 32 bits. */
+    if (magnitude > ((tokenizer->base == 16U) ? 0xFFFFFFFFULL : (tokenizer->negative ? 0x80000000ULL : 0x7FFFFFFFULL)))
+    {
+        tokenizer->base = CMD_BASE_INVALID;
+        return;
+    }
+    tokenizer->magnitude = (uint32_t)magnitude;
+    if (tokenizer->digits < 0xFFU)
+    {
+        tokenizer->digits++;
+    }
+}
+
+static void CMD_TokenizerEndToken(cmd_tokenizer_t *tokenizer)
+{
+    cmd_token_t *token;
+
+    if (!tokenizer->inToken)
+    {
+        return;
+    }
+    tokenizer->inToken = false;
+
+    if (tokenizer->truncated)
+    {
+        return;
+    }
+
+    token = &tokenizer->tokens[tokenizer->count - 1U];
+    if ((tokenizer->base != CMD_BASE_INVALID) && (tokenizer->digits != 0U))
+    {
+        token->type  = (uint8_t)kCMD_TokenInteger;
+        token->value = (int32_t)(tokenizer->negative ? (0U - tokenizer->magnitude) : tokenizer->magnitude);
+    }
+}
+
+static void CMD_TokenizerResetLine(cmd_tokenizer_t *tokenizer)
+{
+    tokenizer->count     = 0U;
+    tokenizer->inToken   = false;
+    tokenizer->lineReady = false;
+    tokenizer->truncated = false;
+}
+
+void CMD_TokenizerInit(cmd_tokenizer_t *tokenizer, uint8_t *buffer, uint32_t size, cmd_token_t *tokens, uint8_t maxTokens)
+{
+    assert((tokenizer != NULL) && (buffer != NULL) && (tokens != NULL));
+    /* Size must be a power of two, a token can fill the ring and its length is 16-bit. */
+    assert((size != 0U) && ((size & (size - 1U)) == 0U) && (size <= 0x8000U));
+
+    tokenizer->buffer    = buffer;
+    tokenizer->mask      = size - 1U;
+    tokenizer->head      = 0U;
+    tokenizer->tail      = 0U;
+    tokenizer->scan      = 0U;
+    tokenizer->dropped   = 0U;
+    tokenizer->tokens    = tokens;
+    tokenizer->maxTokens  = maxTokens;
+    tokenizer->discarding = false;
+    CMD_TokenizerResetLine(tokenizer);
+}
+
+bool CMD_TokenizerPutFromISR(cmd_tokenizer_t *tokenizer, uint8_t data)
+{
+    uint32_t head = tokenizer->head;
+
+    if ((head - tokenizer->tail) > tokenizer->mask)
+    {
+        tokenizer->dropped++;
+        return false;
+    }
+
+    tokenizer->buffer[head & tokenizer->mask] = data;
+    /* Publish the byte before the new head. */
+    __DMB();
+    tokenizer->head = head + 1U;
+
+    return true;
+}
+
+status_t CMD_TokenizerGetLine(cmd_tokenizer_t *tokenizer, uint32_t *count)
+{
+    uint32_t head = tokenizer->head;
+    uint8_t c;
+
+    assert(count != NULL);
+
+    while (!tokenizer->lineReady && (tokenizer->scan != head))
+    {
+        c = tokenizer->buffer[tokenizer->scan & tokenizer->mask];
+        if (c == (uint8_t)'\0')
+        {
+            /* Binary data, not text: drop the partial line and leave the NUL for CMD_TokenizerGetByte(). */
+            tokenizer->tail       = tokenizer->scan;
+            tokenizer->discarding = false;
+            CMD_TokenizerResetLine(tokenizer);
+            *count = 0U;
+            return kStatus_Busy;
+        }
+        else if (tokenizer->discarding)
+        {
+            /* Rest of an overlong line, freed as it is scanned. */
+            tokenizer->discarding = (c != (uint8_t)'\r') && (c != (uint8_t)'\n');
+            tokenizer->scan++;
+            tokenizer->tail = tokenizer->scan;
+        }
+        else if ((c == (uint8_t)'\r') || (c == (uint8_t)'\n'))
+        {
+            CMD_TokenizerEndToken(tokenizer);
+            tokenizer->scan++;
+            if ((tokenizer->count == 0U) && !tokenizer->truncated)
+            {
+                /* Blank line, or the second half of CR LF. */
+                tokenizer->tail = tokenizer->scan;
+            }
+            else
+            {
+                tokenizer->lineReady = true;
+            }
+        }
+        else
+        {
+            if ((c == (uint8_t)' ') || (c == (uint8_t)'\t'))
+            {
+                CMD_TokenizerEndToken(tokenizer);
+            }
+            else if (!tokenizer->inToken)
+            {
+                CMD_TokenizerStartToken(tokenizer, c);
+            }
+            else
+            {
+                CMD_TokenizerAppend(tokenizer, c);
+            }
+            tokenizer->scan++;
+        }
+    }
+
+    if (tokenizer->lineReady)
+    {
+        *count = tokenizer->count;
+        return tokenizer->truncated ? kStatus_OutOfRange : kStatus_Success;
+    }
+
+    *count = 0U;
+    if ((head - tokenizer->tail) > tokenizer->mask)
+    {
+        /* The ring is full without an end of line, drop the line up to its end. */
+        tokenizer->tail       = tokenizer->scan;
+        tokenizer->discarding = true;
+        CMD_TokenizerResetLine(tokenizer);
+        return kStatus_Fail;
+    }
+
+    return kStatus_NoData;
+}
+
+void CMD_TokenizerReleaseLine(cmd_tokenizer_t *tokenizer)
+{
+    if (tokenizer->lineReady)
+    {
+        tokenizer->tail = tokenizer->scan;
+        CMD_TokenizerResetLine(tokenizer);
+    }
+}
+
+bool CMD_TokenizerGetByte(cmd_tokenizer_t *tokenizer, uint8_t *data)
+{
+    uint32_t tail = tokenizer->tail;
+
+    assert((data != NULL) && !tokenizer->lineReady);
+
+    if (tail == tokenizer->head)
+    {
+        return false;
+    }
+
+    *data           = tokenizer->buffer[tail & tokenizer->mask];
+    tokenizer->scan = tail + 1U;
+    /* Free the slot after reading it. */
+    __DMB();
+    tokenizer->tail       = tail + 1U;
+    tokenizer->discarding = false;
+    CMD_TokenizerResetLine(tokenizer);
+
+    return true;
+}
+
+bool CMD_TokenEquals(const cmd_tokenizer_t *tokenizer, const cmd_token_t *token, const char *str)
+{
+    uint32_t i;
+
+    for (i = 0U; i < token->length; i++)
+    {
+        if ((str[i] == '\0') || (str[i] != CMD_TokenCharAt(tokenizer, token, i)))
+        {
+            return false;
+        }
+    }
+
+    return (str[i] == '\0');
+}
+
+uint32_t CMD_TokenCopy(const cmd_tokenizer_t *tokenizer, const cmd_token_t *token, char *str, uint32_t size)
+{
+    uint32_t i;
+
+    assert((str != NULL) && (size != 0U));
+
+    for (i = 0U; (i < token->length) && (i < (size - 1U)); i++)
+    {
+        str[i] = CMD_TokenCharAt(tokenizer, token, i);
+    }
+    str[i] = '\0';
+
+    return i;
+}
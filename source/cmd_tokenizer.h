@@ -0,0 +1,201 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _CMD_TOKENIZER_H_
+#define _CMD_TOKENIZER_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup cmd_tokenizer
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Token types. */
+typedef enum _cmd_token_type
+{
+    kCMD_TokenWord    = 0U, /*!< Any run of non-blank characters. */
+    kCMD_TokenInteger = 1U, /*!< Signed decimal int32_t, or unsigned 0x prefixed hexadecimal 32-bit value. */
+} cmd_token_type_t;
+
+/*!
+ * @brief Token view.
+ *
+ * The token characters are not copied, the view refers to the tokenizer ring
+ * and stays valid until CMD_TokenizerReleaseLine().
+ */
+typedef struct _cmd_token
+{
+    uint32_t position; /*!< Free running ring position of the first character. */
+    uint16_t length;   /*!< Number of characters. */
+    uint8_t type;      /*!< See cmd_token_type_t. */
+    int32_t value;     /*!< Parsed value of a kCMD_TokenInteger token. */
+} cmd_token_t;
+
+/*!
+ * @brief Line tokenizer working in place on a receive ring.
+ *
+ * An ISR pushes received bytes with CMD_TokenizerPutFromISR(). The main context
+ * calls CMD_TokenizerGetLine(), which examines every new byte exactly once and
+ * builds token views and integer values on the fly, so a line is parsed without
+ * being copied and without re-scanning.
+ */
+typedef struct _cmd_tokenizer
+{
+    uint8_t *buffer;           /*!< Ring storage. */
+    uint32_t mask;             /*!< Ring size minus one, the size is a power of two. */
+    volatile uint32_t head;    /*!< Producer position. */
+    volatile uint32_t tail;    /*!< Start of the oldest unreleased line. */
+    uint32_t scan;             /*!< Next byte to examine. */
+    volatile uint32_t dropped; /*!< Bytes dropped because the ring was full. */
+    cmd_token_t *tokens;       /*!< Token storage for the current line. */
+    uint8_t maxTokens;         /*!< Size of the token storage. */
+    uint8_t count;             /*!< Tokens of the current line. */
+    bool inToken;              /*!< The last examined byte belongs to a token. */
+    bool lineReady;            /*!< A complete line is waiting for CMD_TokenizerReleaseLine(). */
+    bool truncated;            /*!< The current line has more tokens than maxTokens. */
+    bool discarding;           /*!< Bytes are dropped up to the next end of line. */
+    bool negative;             /*!< Sign of the integer being parsed. */
+    uint8_t digits;            /*!< Digits of the integer being parsed. */
+    uint8_t base;              /*!< Base of the integer being parsed. */
+    uint32_t magnitude;        /*!< Magnitude of the integer being parsed. */
+} cmd_tokenizer_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes a tokenizer.
+ *
+ * @param tokenizer Tokenizer handle.
+ * @param buffer Ring storage.
+ * @param size Ring size in bytes, a power of two up to 32768, so a token length fits in 16 bits.
+ * @param tokens Token storage.
+ * @param maxTokens Number of tokens a line can hold.
+ */
+void CMD_TokenizerInit(cmd_tokenizer_t *tokenizer, uint8_t *buffer, uint32_t size, cmd_token_t *tokens, uint8_t maxTokens);
+
+/*!
+ * @brief Pushes a received byte. Single producer, typically the UART receive ISR.
+ *
+ * @param tokenizer Tokenizer handle.
+ * @param data Received byte.
+ * @retval true The byte is stored.
+ * @retval false The ring is full, the byte is dropped.
+ */
+bool CMD_TokenizerPutFromISR(cmd_tokenizer_t *tokenizer, uint8_t data);
+
+/*!
+ * @brief Tokenizes the received bytes up to the next end of line. Main context only.
+ *
+ * Blank lines are skipped. A line longer than the ring is discarded up to its end of line, its
+ * tail is not taken as a new line. A NUL byte is not text: the scan stops in front of it and the
+ * partial line before it is dropped, the NUL and the bytes after it are read with
+ * CMD_TokenizerGetByte().
+ *
+ * @param tokenizer Tokenizer handle.
+ * @param count Number of tokens of the line, in the tokens storage.
+ * @retval kStatus_Success A line is ready, release it with CMD_TokenizerReleaseLine().
+ * @retval kStatus_NoData No complete line yet.
+ * @retval kStatus_OutOfRange A line is ready but had more than maxTokens tokens, the extra tokens are dropped.
+ * @retval kStatus_Fail A line longer than the ring was discarded.
+ * @retval kStatus_Busy The next byte is a NUL, binary data follows.
+ */
+status_t CMD_TokenizerGetLine(cmd_tokenizer_t *tokenizer, uint32_t *count);
+
+/*!
+ * @brief Releases the current line, its token views become invalid.
+ *
+ * @param tokenizer Tokenizer handle.
+ */
+void CMD_TokenizerReleaseLine(cmd_tokenizer_t *tokenizer);
+
+/*!
+ * @brief Takes the oldest received byte without tokenizing it. Main context only.
+ *
+ * For binary data sharing the ring with the text lines, no line may be held. Tokenizing
+ * starts again from the next byte.
+ *
+ * @param tokenizer Tokenizer handle.
+ * @param data Received byte.
+ * @retval true A byte is returned.
+ * @retval false The ring is empty.
+ */
+bool CMD_TokenizerGetByte(cmd_tokenizer_t *tokenizer, uint8_t *data);
+
+/*!
+ * @brief Gets the number of received bytes not released yet.
+ *
+ * @param tokenizer Tokenizer handle.
+ * @return Number of bytes in the ring.
+ */
+static inline uint32_t CMD_TokenizerGetPendingCount(const cmd_tokenizer_t *tokenizer)
+{
+    return tokenizer->head - tokenizer->tail;
+}
+
+/*!
+ * @brief Gets a character of a token.
+ *
+ * @param tokenizer Tokenizer handle.
+ * @param token Token view.
+ * @param index Character index, less than the token length.
+ * @return The character.
+ */
+static inline char CMD_TokenCharAt(const cmd_tokenizer_t *tokenizer, const cmd_token_t *token, uint32_t index)
+{
+    return (char)tokenizer->buffer[(token->position + index) & tokenizer->mask];
+}
+
+/*!
+ * @brief Compares a token with a string.
+ *
+ * @param tokenizer Tokenizer handle.
+ * @param token Token view.
+ * @param str NUL terminated string.
+ * @return true if the token and the string are equal.
+ */
+bool CMD_TokenEquals(const cmd_tokenizer_t *tokenizer, const cmd_token_t *token, const char *str);
+
+/*!
+ * @brief Copies a token into a NUL terminated string, for callers that need contiguous text.
+ *
+ * @param tokenizer Tokenizer handle.
+ * @param token Token view.
+ * @param str Destination.
+ * @param size Destination size in bytes, including the NUL.
+ * @return Number of characters copied, without the NUL.
+ */
+uint32_t CMD_TokenCopy(const cmd_tokenizer_t *tokenizer, const cmd_token_t *token, char *str, uint32_t size);
+
+/*!
+ * @brief Gets the number of received bytes dropped because the ring was full.
+ *
+ * @param tokenizer Tokenizer handle.
+ * @return Number of dropped bytes.
+ */
+static inline uint32_t CMD_TokenizerGetDroppedCount(const cmd_tokenizer_t *tokenizer)
+{
+    return tokenizer->dropped;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _CMD_TOKENIZER_H_ */
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "crash_dump.h"
+#include "crc32.h"
+#include "fsl_debug_console.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Words pushed by the core on exception entry: R0-R3, R12, LR, PC, xPSR. */
+#define CRASH_DUMP_FRAME_WORDS (8U)
+
+/* Number of bytes covered by the CRC. */
+#define CRASH_DUMP_CRC_LENGTH (offsetof(crash_dump_record_t, crc))
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* SRAM bounds, from the linker script. */
+extern uint32_t __base_SRAM[];
+extern uint32_t __top_SRAM[];
+
+__attribute__((section(CRASH_DUMP_SECTION))) static crash_dump_record_t s_crashRecord;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+void CRASH_DUMP_FaultHandler(uint32_t *frame, uint32_t excReturn)
+{
+    uint32_t frameAddr = (uint32_t)frame;
+    uint32_t stackAddr;
+    uint32_t i;
+
+    (void)memset(&s_crashRecord, 0, sizeof(s_crashRecord));
+    s_crashRecord.excReturn = excReturn;
+    s_crashRecord.cfsr      = SCB->CFSR;
+    s_crashRecord.hfsr      = SCB->HFSR;
+    s_crashRecord.mmfar     = SCB->MMFAR;
+    s_crashRecord.bfar      = SCB->BFAR;
+
+    /* Only read the frame if the stack pointer is sane, a second fault here would lock up the core. */
+    if ((frameAddr >= (uint32_t)__base_SRAM) && (frameAddr <= ((uint32_t)__top_SRAM - (CRASH_DUMP_FRAME_WORDS * 4U))) &&
+        ((frameAddr & 3U) == 0U))
+    {
+        s_crashRecord.sp   = frameAddr;
+        s_crashRecord.r0   = frame[0];
+        s_crashRecord.r1   = frame[1];
+        s_crashRecord.r2   = frame[2];
+        s_crashRecord.r3   = frame[3];
+        s_crashRecord.r12  = frame[4];
+        s_crashRecord.lr   = frame[5];
+        s_crashRecord.pc   = frame[6];
+        s_crashRecord.xpsr = frame[7];
+
+        stackAddr = frameAddr + (CRASH_DUMP_FRAME_WORDS * 4U);
+        for (i = 0U; (i < CRASH_DUMP_STACK_WORDS) && (stackAddr < (uint32_t)__top_SRAM); i++)
+        {
+            s_crashRecord.stack[i] = *(uint32_t *)stackAddr;
+            stackAddr += 4U;
+        }
+        s_crashRecord.stackWords = i;
+    }
+
+    s_crashRecord.magic = CRASH_DUMP_MAGIC;
+    s_crashRecord.crc   = CRC32_Compute((const uint8_t *)&s_crashRecord, CRASH_DUMP_CRC_LENGTH);
+
+    /* Recover at once instead of spinning in the handler with the clocks running. */
+    NVIC_SystemReset();
+}
+
+status_t CRASH_DUMP_GetRecord(crash_dump_record_t *record)
+{
+    assert(record != NULL);
+
+    if ((s_crashRecord.magic != CRASH_DUMP_MAGIC) ||
+        (s_crashRecord.stackWords > CRASH_DUMP_STACK_WORDS) ||
+        (s_crashRecord.crc != CRC32_Compute((const uint8_t *)&s_crashRecord, CRASH_DUMP_CRC_LENGTH)))
+    {
+        return kStatus_NoData;
+    }
+
+    *record = s_crashRecord;
+
+    return kStatus_Success;
+}
+
+status_t CRASH_DUMP_Report(void)
+{
+    crash_dump_record_t record;
+    uint32_t i;
+
+    if (CRASH_DUMP_GetRecord(&record) != kStatus_Success)
+    {
+        CRASH_DUMP_Clear();
+        return kStatus_NoData;
+    }
+
+    PRINTF("\r\nCrash record from previous run:\r\n");
+    PRINTF("    PC   = 0x%08x  LR   = 0x%08x  xPSR = 0x%08x  SP = 0x%08x\r\n", record.pc, record.lr, record.xpsr,
+           record.sp);
+    PRINTF("    R0   = 0x%08x  R1   = 0x%08x  R2   = 0x%08x  R3 = 0x%08x  R12 = 0x%08x\r\n", record.r0, record.r1,
+           record.r2, record.r3, record.r12);
+    PRINTF("    CFSR = 0x%08x  HFSR = 0x%08x  MMFAR = 0x%08x  BFAR = 0x%08x  EXC_RETURN = 0x%08x\r\n", record.cfsr,
+           record.hfsr, record.mmfar, record.bfar, record.excReturn);
+    PRINTF("    Stack:");
+    for (i = 0U; i < record.stackWords; i++)
+    {
+        if ((i % 4U) == 0U)
+        {
+            PRINTF("\r\n    0x%08x:", record.sp + ((CRASH_DUMP_FRAME_WORDS + i) * 4U));
+        }
+        PRINTF(" 0x%08x", record.stack[i]);
+    }
+    PRINTF("\r\n");
+
+    CRASH_DUMP_Clear();
+
+    return kStatus_Success;
+}
+
+void CRASH_DUMP_Clear(void)
+{
+    s_crashRecord.magic = 0U;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _CRASH_DUMP_H_
+#define _CRASH_DUMP_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup crash_dump
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Number of stack words captured above the exception frame. */
+#ifndef CRASH_DUMP_STACK_WORDS
+#define CRASH_DUMP_STACK_WORDS (32U)
+#endif
+
+/*! @brief Section holding the crash record, must not be cleared by the startup code. */
+#ifndef CRASH_DUMP_SECTION
+#define CRASH_DUMP_SECTION ".noinit"
+#endif
+
+/*! @brief Marks a crash record. */
+#define CRASH_DUMP_MAGIC (0x43525348U) /* 'CRSH' */
+
+/*! @brief Crash record, written by the fault handler and reported on the next boot. */
+typedef struct _crash_dump_record
+{
+    uint32_t magic;      /*!< CRASH_DUMP_MAGIC when a record is present. */
+    uint32_t excReturn;  /*!< EXC_RETURN value of the fault handler. */
+    uint32_t r0;         /*!< Stacked R0. */
+    uint32_t r1;         /*!< Stacked R1. */
+    uint32_t r2;         /*!< Stacked R2. */
+    uint32_t r3;         /*!< Stacked R3. */
+    uint32_t r12;        /*!< Stacked R12. */
+    uint32_t lr;         /*!< Stacked LR. */
+    uint32_t pc;         /*!< Stacked PC, the faulting instruction. */
+    uint32_t xpsr;       /*!< Stacked xPSR. */
+    uint32_t sp;         /*!< Exception frame address, 0 if the stack pointer was invalid. */
+    uint32_t cfsr;       /*!< SCB CFSR. */
+    uint32_t hfsr;       /*!< SCB HFSR. */
+    uint32_t mmfar;      /*!< SCB MMFAR. */
+    uint32_t bfar;       /*!< SCB BFAR. */
+    uint32_t stackWords; /*!< Number of valid words in stack. */
+    uint32_t stack[CRASH_DUMP_STACK_WORDS]; /*!< Stack content above the exception frame. */
+    uint32_t crc;        /*!< CRC-32 of all previous fields. */
+} crash_dump_record_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Records a fault and resets the device. Called by HardFault_Handler.
+ *
+ * @param frame Exception frame pushed by the core.
+ * @param excReturn EXC_RETURN value of the fault handler.
+ */
+void CRASH_DUMP_FaultHandler(uint32_t *frame, uint32_t excReturn);
+
+/*!
+ * @brief Gets the crash record left by the previous run.
+ *
+ * @param record Copy of the crash record.
+ * @retval kStatus_Success A valid record is returned.
+ * @retval kStatus_NoData No record, or the record is corrupted.
+ */
+status_t CRASH_DUMP_GetRecord(crash_dump_record_t *record);
+
+/*!
+ * @brief Prints the crash record left by the previous run on the debug console and clears it.
+ *
+ * The PC and LR can be resolved against the ELF, for example with addr2line.
+ *
+ * @retval kStatus_Success A record was reported.
+ * @retval kStatus_NoData Nothing to report.
+ */
+status_t CRASH_DUMP_Report(void);
+
+/*!
+ * @brief Clears the crash record.
+ */
+void CRASH_DUMP_Clear(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _CRASH_DUMP_H_ */
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "crc32.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Reflected IEEE 802.3 polynomial. */
+#define CRC32_POLYNOMIAL (0xEDB88320U)
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+uint32_t CRC32_Compute(const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = 0xFFFFFFFFU;
+    uint32_t bit;
+
+    assert((data != NULL) || (length == 0U));
+
+    while (length-- != 0U)
+    {
+        crc ^= *data++;
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc = (crc >> 1U) ^ (CRC32_POLYNOMIAL & (0U - (crc & 1U)));
+        }
+    }
+
+    return ~crc;
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _CRC32_H_
+#define _CRC32_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup crc32
+ * @{
+ */
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Computes the CRC-32 (IEEE 802.3) of a buffer.
+ *
+ * Bitwise, without a table: the retained records it protects are a few words and checked once per boot
+ * or fault.
+ *
+ * @param data Buffer.
+ * @param length Length of the buffer in bytes.
+ * @return CRC-32 of the buffer.
+ */
+uint32_t CRC32_Compute(const uint8_t *data, uint32_t length);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _CRC32_H_ */
@@ -0,0 +1,219 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ctrl_protocol.h"
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void CTRL_PutU16(uint8_t *out, uint16_t value);
+static void CTRL_PutU32(uint8_t *out, uint32_t value);
+static uint32_t CTRL_GetU32(const uint8_t *in);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void CTRL_PutU16(uint8_t *out, uint16_t value)
+{
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8U);
+}
+
+static void CTRL_PutU32(uint8_t *out, uint32_t value)
+{
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8U);
+    out[2] = (uint8_t)(value >> 16U);
+    out[3] = (uint8_t)(value >> 24U);
+}
+
+static uint32_t CTRL_GetU32(const uint8_t *in)
+{
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8U) | ((uint32_t)in[2] << 16U) | ((uint32_t)in[3] << 24U);
+}
+
+/* Bitwise CRC, frames are a few tens of bytes. */
+uint16_t CTRL_Crc16(uint16_t crc, const uint8_t *data, uint32_t length)
+{
+    uint32_t bit;
+
+    while (length-- != 0U)
+    {
+        crc ^= (uint16_t)((uint16_t)*data++ << 8U);
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc = (uint16_t)((crc << 1U) ^ (0x1021U & (0U - ((uint32_t)crc >> 15U))));
+        }
+    }
+
+    return crc;
+}
+
+uint32_t CTRL_EncodeFrame(uint8_t seq, uint8_t type, const uint8_t *payload, uint32_t length, uint8_t *out)
+{
+    uint8_t raw[CTRL_MAX_FRAME];
+    uint32_t rawLength = length + 4U;
+    uint32_t code      = 0U; /* Position of the current COBS code byte. */
+    uint32_t outLength = 1U;
+    uint32_t i;
+    uint16_t crc;
+
+    assert(length <= CTRL_MAX_PAYLOAD);
+    assert(out != NULL);
+
+    raw[0] = seq;
+    raw[1] = type;
+    if (length != 0U)
+    {
+        (void)memcpy(&raw[2], payload, length);
+    }
+    crc = CTRL_Crc16(0xFFFFU, raw, length + 2U);
+    CTRL_PutU16(&raw[length + 2U], crc);
+
+    for (i = 0U; i < rawLength; i++)
+    {
+        if (raw[i] == 0U)
+        {
+            out[code] = (uint8_t)(outLength - code);
+            code      = outLength++;
+        }
+        else
+        {
+            out[outLength++] = raw[i];
+            if ((outLength - code) == 0xFFU)
+            {
+                out[code] = 0xFFU;
+                code      = outLength++;
+            }
+        }
+    }
+    out[code]        = (uint8_t)(outLength - code);
+    out[outLength++] = CTRL_FRAME_DELIMITER;
+
+    return outLength;
+}
+
+void CTRL_ReceiverInit(ctrl_receiver_t *receiver)
+{
+    assert(receiver != NULL);
+
+    receiver->count    = 0U;
+    receiver->overflow = false;
+}
+
+status_t CTRL_ReceiverPut(ctrl_receiver_t *receiver, uint8_t data, ctrl_frame_t *frame)
+{
+    uint8_t raw[CTRL_MAX_FRAME];
+    uint32_t rawLength = 0U;
+    uint32_t i         = 0U;
+    uint32_t block;
+    uint32_t end;
+    bool overflow;
+
+    if (data != CTRL_FRAME_DELIMITER)
+    {
+        if (receiver->count < sizeof(receiver->buffer))
+        {
+            receiver->buffer[receiver->count++] = data;
+        }
+        else
+        {
+            receiver->overflow = true;
+        }
+        return kStatus_NoData;
+    }
+
+    /* Delimiter: decode what was collected, and start a new frame in any case. */
+    end                = receiver->count;
+    overflow           = receiver->overflow;
+    receiver->count    = 0U;
+    receiver->overflow = false;
+
+    if (overflow)
+    {
+        return kStatus_OutOfRange;
+    }
+    if (end == 0U)
+    {
+        return kStatus_NoData;
+    }
+
+    while (i < end)
+    {
+        block = receiver->buffer[i++];
+        /* Code bytes are never 0, the delimiter ended the frame. */
+        if ((i + block - 1U) > end)
+        {
+            return kStatus_InvalidArgument;
+        }
+        if ((rawLength + block - 1U) > CTRL_MAX_FRAME)
+        {
+            return kStatus_OutOfRange;
+        }
+        (void)memcpy(&raw[rawLength], &receiver->buffer[i], block - 1U);
+        rawLength += block - 1U;
+        i += block - 1U;
+        /* A block shorter than 0xFF stands for a zero, except the last one. */
+        if ((block != 0xFFU) && (i < end))
+        {
+            if (rawLength >= CTRL_MAX_FRAME)
+            {
+                return kStatus_OutOfRange;
+            }
+            raw[rawLength++] = 0U;
+        }
+    }
+
+    if (rawLength < 4U)
+    {
+        return kStatus_InvalidArgument;
+    }
+    if (CTRL_Crc16(0xFFFFU, raw, rawLength - 2U) !=
+        (uint16_t)((uint16_t)raw[rawLength - 2U] | ((uint16_t)raw[rawLength - 1U] << 8U)))
+    {
+        return kStatus_Fail;
+    }
+
+    assert(frame != NULL);
+    frame->seq    = raw[0];
+    frame->type   = raw[1];
+    frame->length = (uint8_t)(rawLength - 4U);
+    (void)memcpy(frame->payload, &raw[2], rawLength - 4U);
+
+    return kStatus_Success;
+}
+
+status_t CTRL_ParseCycleRequest(const ctrl_frame_t *frame, ctrl_cycle_request_t *request)
+{
+    assert((frame != NULL) && (request != NULL));
+
+    if (frame->length != CTRL_CYCLE_REQUEST_SIZE)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    request->powerMode = frame->payload[0];
+    request->wakeMode  = frame->payload[1];
+    request->dwellMs   = CTRL_GetU32(&frame->payload[2]);
+    request->repeat    = (uint16_t)((uint16_t)frame->payload[6] | ((uint16_t)frame->payload[7] << 8U));
+
+    return kStatus_Success;
+}
+
+void CTRL_SerializeTelemetry(const ctrl_cycle_telemetry_t *telemetry, uint8_t *out)
+{
+    assert((telemetry != NULL) && (out != NULL));
+
+    CTRL_PutU16(&out[0], telemetry->completed);
+    CTRL_PutU32(&out[2], telemetry->coreClock);
+    CTRL_PutU32(&out[6], telemetry->sleepMsMin);
+    CTRL_PutU32(&out[10], telemetry->sleepMsMax);
+    CTRL_PutU32(&out[14], telemetry->sleepMsTotal);
+    CTRL_PutU32(&out[18], telemetry->entryCyclesMax);
+    CTRL_PutU32(&out[22], telemetry->resumeCyclesMin);
+    CTRL_PutU32(&out[26], telemetry->resumeCyclesMax);
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _CTRL_PROTOCOL_H_
+#define _CTRL_PROTOCOL_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup ctrl_protocol
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @brief Framing of the host control protocol.
+ *
+ * A frame is the COBS encoding of
+ *
+ *     seq (1 byte) | type (1 byte) | payload (0..CTRL_MAX_PAYLOAD bytes) | CRC-16 (2 bytes, little endian)
+ *
+ * followed by a single 0x00 delimiter. The host also sends a delimiter before each frame, which flushes
+ * partial input and switches the console menu to host control. The CRC is CRC-16/CCITT-FALSE over seq, type and payload.
+ * Multi-byte payload fields are little endian. A response carries the sequence number of its request,
+ * so the host can match replies and safely retry: a request repeating the previous sequence number is
+ * not executed again, the previous response is sent instead.
+ */
+
+/*! @brief Frame delimiter, never appears inside an encoded frame. */
+#define CTRL_FRAME_DELIMITER (0x00U)
+
+/*! @brief Largest payload of a frame. */
+#ifndef CTRL_MAX_PAYLOAD
+#define CTRL_MAX_PAYLOAD (32U)
+#endif
+
+/*! @brief Decoded frame size: seq, type, payload and CRC. */
+#define CTRL_MAX_FRAME (CTRL_MAX_PAYLOAD + 4U)
+
+/*! @brief Encoded frame size: COBS adds one byte per 254 bytes plus one, then the delimiter. */
+#define CTRL_MAX_ENCODED_FRAME (CTRL_MAX_FRAME + (CTRL_MAX_FRAME / 254U) + 2U)
+
+/*! @brief Protocol version, reported by kCTRL_CmdPing. */
+#define CTRL_PROTOCOL_VERSION (1U)
+
+/*! @brief Frame types. Responses have bit 7 set and echo the request type in the low bits. */
+enum _ctrl_frame_type
+{
+    kCTRL_CmdPing       = 0x01U, /*!< No payload. Response: version u8, core clock u32. */
+    kCTRL_CmdRunCycles  = 0x02U, /*!< Payload: ctrl_cycle_request_t. Response: ctrl_cycle_telemetry_t. */
+    kCTRL_CmdExit       = 0x03U, /*!< No payload. Leaves host control, response: status only. */
+    kCTRL_ResponseFlag  = 0x80U, /*!< Set in the type of every response. */
+    kCTRL_ResponseError = 0xFFU, /*!< Response to a frame that could not be decoded, payload: status u8. */
+};
+
+/*! @brief Status byte, first payload byte of every response. */
+enum _ctrl_status
+{
+    kCTRL_StatusOk           = 0x00U, /*!< Request executed. */
+    kCTRL_StatusBadFrame     = 0x01U, /*!< COBS or length error. */
+    kCTRL_StatusBadCrc       = 0x02U, /*!< CRC mismatch. */
+    kCTRL_StatusUnknown      = 0x03U, /*!< Unknown request type. */
+    kCTRL_StatusInvalidParam = 0x04U, /*!< Wrong payload length or parameter out of range. */
+};
+
+/*! @brief kCTRL_CmdRunCycles request payload, CTRL_CYCLE_REQUEST_SIZE bytes on the wire. */
+typedef struct _ctrl_cycle_request
+{
+    uint8_t powerMode; /*!< Target power mode, same letters as the console menu. */
+    uint8_t wakeMode;  /*!< Wake up profile, same digits as the console menu. */
+    uint32_t dwellMs;  /*!< Time spent in the low power mode per cycle, woken by the wake timer. */
+    uint16_t repeat;   /*!< Number of cycles. */
+} ctrl_cycle_request_t;
+
+/*! @brief Wire size of ctrl_cycle_request_t. */
+#define CTRL_CYCLE_REQUEST_SIZE (8U)
+
+/*! @brief kCTRL_CmdRunCycles response payload, after the status byte. CTRL_CYCLE_TELEMETRY_SIZE bytes. */
+typedef struct _ctrl_cycle_telemetry
+{
+    uint16_t completed;         /*!< Cycles run. */
+    uint32_t coreClock;         /*!< Core clock of the wake up profile, in Hz. */
+    uint32_t sleepMsMin;        /*!< Shortest time between entry and wake up, 1 ms ticks. */
+    uint32_t sleepMsMax;        /*!< Longest time between entry and wake up, 1 ms ticks. */
+    uint32_t sleepMsTotal;      /*!< Sum of the times between entry and wake up, 1 ms ticks. */
+    uint32_t entryCyclesMax;    /*!< Longest wake profile set up and entry path, core cycles. */
+    uint32_t resumeCyclesMin;   /*!< Shortest path from wake up to console restored, core cycles. */
+    uint32_t resumeCyclesMax;   /*!< Longest path from wake up to console restored, core cycles. */
+} ctrl_cycle_telemetry_t;
+
+/*! @brief Wire size of ctrl_cycle_telemetry_t. */
+#define CTRL_CYCLE_TELEMETRY_SIZE (30U)
+
+/*! @brief Decoded frame. */
+typedef struct _ctrl_frame
+{
+    uint8_t seq;                        /*!< Sequence number. */
+    uint8_t type;                       /*!< Frame type. */
+    uint8_t length;                     /*!< Payload length. */
+    uint8_t payload[CTRL_MAX_PAYLOAD];  /*!< Payload. */
+} ctrl_frame_t;
+
+/*!
+ * @brief Frame receiver, collects encoded bytes up to the delimiter.
+ */
+typedef struct _ctrl_receiver
+{
+    uint8_t buffer[CTRL_MAX_ENCODED_FRAME]; /*!< Encoded bytes of the current frame. */
+    uint32_t count;                         /*!< Bytes in buffer. */
+    bool overflow;                          /*!< The current frame does not fit, drop it at the delimiter. */
+} ctrl_receiver_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Computes a CRC-16/CCITT-FALSE.
+ *
+ * @param crc Initial value, 0xFFFF for a new computation or the previous result to continue.
+ * @param data Data.
+ * @param length Data length in bytes.
+ * @return The CRC.
+ */
+uint16_t CTRL_Crc16(uint16_t crc, const uint8_t *data, uint32_t length);
+
+/*!
+ * @brief Builds an encoded frame, delimiter included.
+ *
+ * @param seq Sequence number.
+ * @param type Frame type.
+ * @param payload Payload, may be NULL if length is 0.
+ * @param length Payload length, up to CTRL_MAX_PAYLOAD.
+ * @param out Encoded frame, at least CTRL_MAX_ENCODED_FRAME bytes.
+ * @return Encoded frame length in bytes.
+ */
+uint32_t CTRL_EncodeFrame(uint8_t seq, uint8_t type, const uint8_t *payload, uint32_t length, uint8_t *out);
+
+/*!
+ * @brief Resets a frame receiver.
+ *
+ * @param receiver Receiver handle.
+ */
+void CTRL_ReceiverInit(ctrl_receiver_t *receiver);
+
+/*!
+ * @brief Feeds a received byte.
+ *
+ * @param receiver Receiver handle.
+ * @param data Received byte.
+ * @param frame Decoded frame, valid when kStatus_Success is returned.
+ * @retval kStatus_Success A frame is decoded.
+ * @retval kStatus_NoData No complete frame yet, or an empty frame between two delimiters.
+ * @retval kStatus_OutOfRange A frame longer than CTRL_MAX_FRAME was dropped.
+ * @retval kStatus_InvalidArgument A frame with a COBS or length error was dropped.
+ * @retval kStatus_Fail A frame with a bad CRC was dropped.
+ */
+status_t CTRL_ReceiverPut(ctrl_receiver_t *receiver, uint8_t data, ctrl_frame_t *frame);
+
+/*!
+ * @brief Parses a kCTRL_CmdRunCycles payload.
+ *
+ * @param frame Decoded request.
+ * @param request Parsed request.
+ * @retval kStatus_Success The payload has the right size.
+ * @retval kStatus_InvalidArgument Wrong payload size.
+ */
+status_t CTRL_ParseCycleRequest(const ctrl_frame_t *frame, ctrl_cycle_request_t *request);
+
+/*!
+ * @brief Serializes cycle telemetry.
+ *
+ * @param telemetry Telemetry.
+ * @param out Output, CTRL_CYCLE_TELEMETRY_SIZE bytes.
+ */
+void CTRL_SerializeTelemetry(const ctrl_cycle_telemetry_t *telemetry, uint8_t *out);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _CTRL_PROTOCOL_H_ */
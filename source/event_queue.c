@@ -0,0 +1,195 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "event_queue.h"
+#if !(defined(EVENT_QUEUE_USE_EXCLUSIVE_ACCESS) && (EVENT_QUEUE_USE_EXCLUSIVE_ACCESS > 0U))
+#include <stdatomic.h>
+#endif
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static inline uint32_t EVENT_QUEUE_LoadAcquire(EVENT_QUEUE_ATOMIC uint32_t *addr);
+static inline void EVENT_QUEUE_StoreRelease(EVENT_QUEUE_ATOMIC uint32_t *addr, uint32_t value);
+static void EVENT_QUEUE_Increment(EVENT_QUEUE_ATOMIC uint32_t *addr);
+static bool EVENT_QUEUE_Reserve(event_queue_t *queue, uint32_t *position);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+#if (defined(EVENT_QUEUE_USE_EXCLUSIVE_ACCESS) && (EVENT_QUEUE_USE_EXCLUSIVE_ACCESS > 0U))
+static inline uint32_t EVENT_QUEUE_LoadAcquire(EVENT_QUEUE_ATOMIC uint32_t *addr)
+{
+    uint32_t value = *addr;
+    __DMB();
+    return value;
+}
+
+static inline void EVENT_QUEUE_StoreRelease(EVENT_QUEUE_ATOMIC uint32_t *addr, uint32_t value)
+{
+    __DMB();
+    *addr = value;
+}
+
+static void EVENT_QUEUE_Increment(EVENT_QUEUE_ATOMIC uint32_t *addr)
+{
+    do
+    {
+    } while (__STREXW(__LDREXW(addr) + 1U, addr) != 0U);
+}
+
+/* Reserves the slot at the tail. Any exception taken between LDREX and STREX
+ * clears the local monitor, so a preempting producer makes the store fail and
+ * the reservation is retried with the updated tail. */
+static bool EVENT_QUEUE_Reserve(event_queue_t *queue, uint32_t *position)
+{
+    uint32_t pos;
+    int32_t diff;
+
+    for (;;)
+    {
+        pos  = __LDREXW(&queue->tail);
+        diff = (int32_t)(queue->slots[pos & queue->mask].sequence - pos);
+        if (diff == 0)
+        {
+            if (__STREXW(pos + 1U, &queue->tail) == 0U)
+            {
+                break;
+            }
+        }
+        else
+        {
+            __CLREX();
+            if (diff < 0)
+            {
+                /* The consumer has not released this slot yet: queue is full. */
+                return false;
+            }
+        }
+    }
+
+    __DMB();
+    *position = pos;
+    return true;
+}
+#else
+static inline uint32_t EVENT_QUEUE_LoadAcquire(EVENT_QUEUE_ATOMIC uint32_t *addr)
+{
+    return atomic_load_explicit(addr, memory_order_acquire);
+}
+
+static inline void EVENT_QUEUE_StoreRelease(EVENT_QUEUE_ATOMIC uint32_t *addr, uint32_t value)
+{
+    atomic_store_explicit(addr, value, memory_order_release);
+}
+
+static void EVENT_QUEUE_Increment(EVENT_QUEUE_ATOMIC uint32_t *addr)
+{
+    (void)atomic_fetch_add_explicit(addr, 1U, memory_order_relaxed);
+}
+
+static bool EVENT_QUEUE_Reserve(event_queue_t *queue, uint32_t *position)
+{
+    uint32_t pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    int32_t diff;
+
+    for (;;)
+    {
+        diff = (int32_t)(EVENT_QUEUE_LoadAcquire(&queue->slots[pos & queue->mask].sequence) - pos);
+        if (diff == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&queue->tail, &pos, pos + 1U, memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+        }
+    }
+
+    *position = pos;
+    return true;
+}
+#endif /* EVENT_QUEUE_USE_EXCLUSIVE_ACCESS */
+
+void EVENT_QUEUE_Init(event_queue_t *queue, event_queue_slot_t *slots, uint32_t capacity)
+{
+    uint32_t i;
+
+    assert((queue != NULL) && (slots != NULL));
+    /* Capacity must be a non-zero power of two. */
+    assert((capacity != 0U) && ((capacity & (capacity - 1U)) == 0U));
+
+    for (i = 0U; i < capacity; i++)
+    {
+        slots[i].sequence = i;
+        slots[i].event    = 0U;
+    }
+
+    queue->slots   = slots;
+    queue->mask    = capacity - 1U;
+    queue->head    = 0U;
+    queue->tail    = 0U;
+    queue->dropped = 0U;
+}
+
+status_t EVENT_QUEUE_Post(event_queue_t *queue, uint32_t event)
+{
+    uint32_t pos;
+    event_queue_slot_t *slot;
+
+    if (!EVENT_QUEUE_Reserve(queue, &pos))
+    {
+        EVENT_QUEUE_Increment(&queue->dropped);
+        return kStatus_OutOfRange;
+    }
+
+    slot        = &queue->slots[pos & queue->mask];
+    slot->event = event;
+    /* Publish: the consumer only reads the payload after seeing this sequence. */
+    EVENT_QUEUE_StoreRelease(&slot->sequence, pos + 1U);
+
+    return kStatus_Success;
+}
+
+status_t EVENT_QUEUE_Get(event_queue_t *queue, uint32_t *event)
+{
+    uint32_t pos = queue->head;
+    event_queue_slot_t *slot = &queue->slots[pos & queue->mask];
+
+    assert(event != NULL);
+
+    if (EVENT_QUEUE_LoadAcquire(&slot->sequence) != (pos + 1U))
+    {
+        /* Empty, or the oldest reservation is not yet published by its producer. */
+        return kStatus_NoData;
+    }
+
+    *event      = slot->event;
+    queue->head = pos + 1U;
+    /* Hand the slot back to producers for the next lap of the ring. */
+    EVENT_QUEUE_StoreRelease(&slot->sequence, pos + queue->mask + 1U);
+
+    return kStatus_Success;
+}
+
+bool EVENT_QUEUE_IsEmpty(event_queue_t *queue)
+{
+    return (EVENT_QUEUE_LoadAcquire(&queue->tail) == queue->head);
+}
+
+uint32_t EVENT_QUEUE_GetDroppedCount(event_queue_t *queue)
+{
+    return EVENT_QUEUE_LoadAcquire(&queue->dropped);
+}
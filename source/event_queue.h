@@ -0,0 +1,132 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _EVENT_QUEUE_H_
+#define _EVENT_QUEUE_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup event_queue
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*
+ * The queue is a bounded multi-producer, single-consumer ring. Producers are ISRs
+ * running at any priority, the consumer is the main context. A producer reserves
+ * a slot by advancing the tail with an exclusive load/store (LDREX/STREX) on the
+ * target, or a C11 compare-exchange in a host build, then publishes the slot by
+ * writing its sequence number. Neither side masks interrupts.
+ */
+#if defined(__arm__) || defined(__ARMCC_VERSION) || defined(__ICCARM__)
+#define EVENT_QUEUE_USE_EXCLUSIVE_ACCESS (1U)
+#define EVENT_QUEUE_ATOMIC               volatile
+#else
+#define EVENT_QUEUE_USE_EXCLUSIVE_ACCESS (0U)
+#define EVENT_QUEUE_ATOMIC               _Atomic
+#endif
+
+/*!
+ * @brief Defines the static storage of an event queue.
+ *
+ * @param name - Name of the storage.
+ * @param capacity - Number of slots, must be a power of two.
+ */
+#define EVENT_QUEUE_DEFINE(name, capacity) static event_queue_slot_t s_##name##Slots[(capacity)]
+
+/*! @brief Gets the slot array declared by EVENT_QUEUE_DEFINE(). */
+#define EVENT_QUEUE_SLOTS(name) (&s_##name##Slots[0])
+
+/*! @brief One queue slot. */
+typedef struct _event_queue_slot
+{
+    EVENT_QUEUE_ATOMIC uint32_t sequence; /*!< Slot sequence, tells producers and consumer who owns the slot. */
+    uint32_t event;                       /*!< Event payload. */
+} event_queue_slot_t;
+
+/*! @brief Event queue handle. */
+typedef struct _event_queue
+{
+    event_queue_slot_t *slots;        /*!< Slot array. */
+    uint32_t mask;                    /*!< Capacity - 1. */
+    EVENT_QUEUE_ATOMIC uint32_t tail; /*!< Next slot to reserve, shared by producers. */
+    uint32_t head;                    /*!< Next slot to consume, owned by the consumer. */
+    EVENT_QUEUE_ATOMIC uint32_t dropped; /*!< Number of events lost because the queue was full. */
+} event_queue_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes an event queue.
+ *
+ * @param queue Queue handle.
+ * @param slots Slot array, see EVENT_QUEUE_DEFINE().
+ * @param capacity Number of slots, must be a power of two.
+ */
+void EVENT_QUEUE_Init(event_queue_t *queue, event_queue_slot_t *slots, uint32_t capacity);
+
+/*!
+ * @brief Posts an event to the queue.
+ *
+ * Safe to call from any interrupt priority and from the main context. The
+ * function never blocks and never masks interrupts.
+ *
+ * @param queue Queue handle.
+ * @param event Event payload.
+ * @retval kStatus_Success The event was queued.
+ * @retval kStatus_OutOfRange The queue was full, the event is counted as dropped.
+ */
+status_t EVENT_QUEUE_Post(event_queue_t *queue, uint32_t event);
+
+/*!
+ * @brief Gets the oldest event from the queue.
+ *
+ * Must only be called from the single consumer context.
+ *
+ * @param queue Queue handle.
+ * @param event Receives the event payload.
+ * @retval kStatus_Success An event was returned.
+ * @retval kStatus_NoData No published event is available.
+ */
+status_t EVENT_QUEUE_Get(event_queue_t *queue, uint32_t *event);
+
+/*!
+ * @brief Checks whether the queue holds no event.
+ *
+ * An event whose slot is reserved but not yet published counts as present, so
+ * the caller never goes to sleep while a producer is half way through a post.
+ *
+ * @param queue Queue handle.
+ * @return true if the queue is empty.
+ */
+bool EVENT_QUEUE_IsEmpty(event_queue_t *queue);
+
+/*!
+ * @brief Gets the number of events dropped because the queue was full.
+ *
+ * @param queue Queue handle.
+ * @return Dropped event count.
+ */
+uint32_t EVENT_QUEUE_GetDroppedCount(event_queue_t *queue);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _EVENT_QUEUE_H_ */
@@ -0,0 +1,321 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fro_trim.h"
+#include "fsl_clock.h"
+#include "clock_verify.h"
+#include "crc32.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Number of bytes covered by the CRC. */
+#define FRO_TRIM_CRC_LENGTH (offsetof(fro_trim_record_t, crc))
+
+/* Trimmed oscillator. */
+typedef struct _fro_trim_osc
+{
+    uint32_t oscillator;          /* clock_oscillator_t. */
+    clock_verify_target_t target; /* Measured clock. */
+    uint8_t fineMax;              /* Largest fine trim. */
+} fro_trim_osc_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void FRO_TRIM_ReadFactory(void);
+static bool FRO_TRIM_IsNearFactory(uint32_t index, uint8_t coarse, uint8_t fine);
+static uint32_t FRO_TRIM_Abs(int32_t value);
+static int32_t FRO_TRIM_DivRound(int32_t num, int32_t den);
+static void FRO_TRIM_Get(const fro_trim_osc_t *osc, uint8_t *coarse, uint8_t *fine);
+static status_t FRO_TRIM_Apply(const fro_trim_osc_t *osc, uint8_t coarse, uint8_t fine);
+static status_t FRO_TRIM_Measure(const fro_trim_osc_t *osc, int32_t *errorPpm);
+static status_t FRO_TRIM_CalibrateOne(const fro_trim_osc_t *osc, uint8_t coarse, uint8_t *fine, int32_t *errorPpm);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const fro_trim_osc_t s_froTrimOscs[] = {
+    {(uint32_t)kCLOCK_OscFroHf, kCLOCK_VERIFY_FroHfDiv, (uint8_t)SCG_FIRCSTAT_TRIMFINE_MASK},
+    {(uint32_t)kCLOCK_OscFro12M, kCLOCK_VERIFY_Fro12M, (uint8_t)SCG_SIRCSTAT_CCOTRIM_MASK},
+};
+
+__attribute__((section(FRO_TRIM_SECTION))) static fro_trim_record_t s_froTrimRecord;
+
+/* Trims loaded at reset, indexed like s_froTrimOscs. */
+static uint8_t s_froTrimFactoryCoarse[ARRAY_SIZE(s_froTrimOscs)];
+static uint8_t s_froTrimFactoryFine[ARRAY_SIZE(s_froTrimOscs)];
+static bool s_froTrimFactoryRead;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* Reads the trims loaded at reset, before the first trim change. */
+static void FRO_TRIM_ReadFactory(void)
+{
+    uint32_t i;
+
+    if (!s_froTrimFactoryRead)
+    {
+        for (i = 0U; i < ARRAY_SIZE(s_froTrimOscs); i++)
+        {
+            FRO_TRIM_Get(&s_froTrimOscs[i], &s_froTrimFactoryCoarse[i], &s_froTrimFactoryFine[i]);
+        }
+        s_froTrimFactoryRead = true;
+    }
+}
+
+static bool FRO_TRIM_IsNearFactory(uint32_t index, uint8_t coarse, uint8_t fine)
+{
+    return (coarse == s_froTrimFactoryCoarse[index]) &&
+           (FRO_TRIM_Abs((int32_t)fine - (int32_t)s_froTrimFactoryFine[index]) <= FRO_TRIM_MAX_FINE_DELTA);
+}
+
+static uint32_t FRO_TRIM_Abs(int32_t value)
+{
+    return (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value;
+}
+
+/* Division rounded to the nearest integer, den is not 0. */
+static int32_t FRO_TRIM_DivRound(int32_t num, int32_t den)
+{
+    return ((num < 0) == (den < 0)) ? ((num + (den / 2)) / den) : ((num - (den / 2)) / den);
+}
+
+static void FRO_TRIM_Get(const fro_trim_osc_t *osc, uint8_t *coarse, uint8_t *fine)
+{
+    if (osc->oscillator == (uint32_t)kCLOCK_OscFroHf)
+    {
+        CLOCK_GetFROHFTrim(coarse, fine);
+    }
+    else
+    {
+        CLOCK_GetFRO12MTrim(coarse, fine);
+    }
+}
+
+static status_t FRO_TRIM_Apply(const fro_trim_osc_t *osc, uint8_t coarse, uint8_t fine)
+{
+    firc_trim_config_t fircConfig;
+    sirc_trim_config_t sircConfig;
+
+    /* Fixed trim, the trim source is not used. */
+    if (osc->oscillator == (uint32_t)kCLOCK_OscFroHf)
+    {
+        fircConfig.trimMode = kSCG_FircTrimNonUpdate;
+        fircConfig.trimSrc  = kSCG_FircTrimSrcUsb0;
+        fircConfig.trimDiv  = 0U;
+        fircConfig.trimCoar = coarse;
+        fircConfig.trimFine = fine;
+        return CLOCK_FROHFTrimConfig(fircConfig);
+    }
+
+    sircConfig.trimMode = kSCG_SircTrimNonUpdate;
+    sircConfig.trimSrc  = kNoTrimSrc;
+    sircConfig.trimDiv  = 0U;
+    sircConfig.cltrim   = coarse;
+    sircConfig.ccotrim  = fine;
+    return CLOCK_FRO12MTrimConfig(sircConfig);
+}
+
+static status_t FRO_TRIM_Measure(const fro_trim_osc_t *osc, int32_t *errorPpm)
+{
+    clock_verify_result_t result;
+    status_t status;
+
+    status = CLOCK_VERIFY_Measure(osc->target, CLOCK_VERIFY_REF_SCALE, &result);
+    *errorPpm = result.errorPpm;
+
+    return status;
+}
+
+/*
+ * Measures the error per fine trim step with a probe step, then steps straight to the trim that cancels
+ * the error and refines from there. Stops when a step does not improve the error.
+ */
+static status_t FRO_TRIM_CalibrateOne(const fro_trim_osc_t *osc, uint8_t coarse, uint8_t *fine, int32_t *errorPpm)
+{
+    uint8_t best = *fine;
+    uint8_t next;
+    int32_t bestError;
+    int32_t error;
+    int32_t slope;
+    int32_t target;
+    uint32_t step;
+
+    if (FRO_TRIM_Measure(osc, &bestError) != kStatus_Success)
+    {
+        return kStatus_Fail;
+    }
+
+    if (FRO_TRIM_Abs(bestError) > FRO_TRIM_TARGET_PPM)
+    {
+        next = (best < osc->fineMax) ? (uint8_t)(best + 1U) : (uint8_t)(best - 1U);
+        if ((FRO_TRIM_Apply(osc, coarse, next) != kStatus_Success) || (FRO_TRIM_Measure(osc, &error) != kStatus_Success))
+        {
+            (void)FRO_TRIM_Apply(osc, coarse, best);
+            return kStatus_Fail;
+        }
+
+        slope = (error - bestError) * ((next > best) ? 1 : -1);
+        if (slope == 0)
+        {
+            /* The trim has no measurable effect at this reference resolution. */
+            (void)FRO_TRIM_Apply(osc, coarse, best);
+            return kStatus_Fail;
+        }
+        if (FRO_TRIM_Abs(error) < FRO_TRIM_Abs(bestError))
+        {
+            best      = next;
+            bestError = error;
+        }
+
+        for (step = 0U; (step < FRO_TRIM_MAX_STEPS) && (FRO_TRIM_Abs(bestError) > FRO_TRIM_TARGET_PPM); step++)
+        {
+            target = (int32_t)best - FRO_TRIM_DivRound(bestError, slope);
+            next   = (uint8_t)((target < 0) ? 0 : ((target > (int32_t)osc->fineMax) ? (int32_t)osc->fineMax : target));
+            if (next == best)
+            {
+                break;
+            }
+            if ((FRO_TRIM_Apply(osc, coarse, next) != kStatus_Success) ||
+                (FRO_TRIM_Measure(osc, &error) != kStatus_Success) || (FRO_TRIM_Abs(error) >= FRO_TRIM_Abs(bestError)))
+            {
+                break;
+            }
+            best      = next;
+            bestError = error;
+        }
+
+        (void)FRO_TRIM_Apply(osc, coarse, best);
+    }
+
+    *fine     = best;
+    *errorPpm = bestError;
+
+    return (FRO_TRIM_Abs(bestError) <= FRO_TRIM_ACCEPT_PPM) ? kStatus_Success : kStatus_Fail;
+}
+
+status_t FRO_TRIM_Restore(void)
+{
+    fro_trim_record_t record;
+    uint8_t coarse;
+    uint8_t fine;
+    status_t status = kStatus_NoData;
+    uint32_t i;
+
+    FRO_TRIM_ReadFactory();
+
+    if (FRO_TRIM_GetRecord(&record) != kStatus_Success)
+    {
+        return kStatus_NoData;
+    }
+
+    for (i = 0U; i < ARRAY_SIZE(s_froTrimOscs); i++)
+    {
+        if ((record.oscillators & s_froTrimOscs[i].oscillator) == 0U)
+        {
+            continue;
+        }
+        if (s_froTrimOscs[i].oscillator == (uint32_t)kCLOCK_OscFroHf)
+        {
+            coarse = record.froHfCoarse;
+            fine   = record.froHfFine;
+        }
+        else
+        {
+            coarse = record.fro12MCoarse;
+            fine   = record.fro12MFine;
+        }
+        /* Another part or a record calibrated against a wrong reference, keep the factory trim. */
+        if (FRO_TRIM_IsNearFactory(i, coarse, fine))
+        {
+            (void)FRO_TRIM_Apply(&s_froTrimOscs[i], coarse, fine);
+            status = kStatus_Success;
+        }
+    }
+
+    return status;
+}
+
+status_t FRO_TRIM_Calibrate(uint32_t oscillators)
+{
+    fro_trim_record_t record;
+    const fro_trim_osc_t *osc;
+    uint8_t coarse;
+    uint8_t fine;
+    uint8_t previous;
+    int32_t error;
+    status_t status = kStatus_Success;
+    uint32_t i;
+
+    FRO_TRIM_ReadFactory();
+
+    if (FRO_TRIM_GetRecord(&record) != kStatus_Success)
+    {
+        (void)memset(&record, 0, sizeof(record));
+    }
+
+    for (i = 0U; i < ARRAY_SIZE(s_froTrimOscs); i++)
+    {
+        osc = &s_froTrimOscs[i];
+        if ((oscillators & osc->oscillator) == 0U)
+        {
+            continue;
+        }
+
+        FRO_TRIM_Get(osc, &coarse, &fine);
+        previous = fine;
+        /* The reference is trusted only close to the factory trim. */
+        if ((FRO_TRIM_CalibrateOne(osc, coarse, &fine, &error) != kStatus_Success) ||
+            !FRO_TRIM_IsNearFactory(i, coarse, fine))
+        {
+            /* Keep the trim in use before this calibration. */
+            (void)FRO_TRIM_Apply(osc, coarse, previous);
+            status = kStatus_Fail;
+            continue;
+        }
+
+        record.oscillators |= osc->oscillator;
+        if (osc->oscillator == (uint32_t)kCLOCK_OscFroHf)
+        {
+            record.froHfCoarse   = coarse;
+            record.froHfFine     = fine;
+            record.froHfErrorPpm = error;
+        }
+        else
+        {
+            record.fro12MCoarse   = coarse;
+            record.fro12MFine     = fine;
+            record.fro12MErrorPpm = error;
+        }
+    }
+
+    if (record.oscillators != 0U)
+    {
+        record.magic    = FRO_TRIM_MAGIC;
+        record.crc      = CRC32_Compute((const uint8_t *)&record, FRO_TRIM_CRC_LENGTH);
+        s_froTrimRecord = record;
+    }
+
+    return status;
+}
+
+status_t FRO_TRIM_GetRecord(fro_trim_record_t *record)
+{
+    assert(record != NULL);
+
+    if ((s_froTrimRecord.magic != FRO_TRIM_MAGIC) ||
+        (s_froTrimRecord.crc != CRC32_Compute((const uint8_t *)&s_froTrimRecord, FRO_TRIM_CRC_LENGTH)))
+    {
+        return kStatus_NoData;
+    }
+
+    *record = s_froTrimRecord;
+
+    return kStatus_Success;
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FRO_TRIM_H_
+#define _FRO_TRIM_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup fro_trim
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Section holding the trim record, must not be cleared by the startup code. */
+#ifndef FRO_TRIM_SECTION
+#define FRO_TRIM_SECTION ".noinit"
+#endif
+
+/*! @brief Error at which a calibration stops stepping the trim, in ppm. */
+#ifndef FRO_TRIM_TARGET_PPM
+#define FRO_TRIM_TARGET_PPM (500U)
+#endif
+
+/*! @brief Largest residual error of a trim kept as good, in ppm. */
+#ifndef FRO_TRIM_ACCEPT_PPM
+#define FRO_TRIM_ACCEPT_PPM (5000U)
+#endif
+
+/*! @brief Trim corrections per calibration, after the probe step. */
+#ifndef FRO_TRIM_MAX_STEPS
+#define FRO_TRIM_MAX_STEPS (6U)
+#endif
+
+/*! @brief Largest distance of a kept fine trim from the factory trim, in fine trim steps.
+ *
+ * The FRO16K reference is an RC oscillator itself, a trim far from the factory trim more likely follows a
+ * reference error than a drift of the trimmed FRO.
+ */
+#ifndef FRO_TRIM_MAX_FINE_DELTA
+#define FRO_TRIM_MAX_FINE_DELTA (16U)
+#endif
+
+/*! @brief Marks a trim record. */
+#define FRO_TRIM_MAGIC (0x5452494DU) /* 'TRIM' */
+
+/*! @brief Last good trims, kept in RAM that survives resets and low power modes. */
+typedef struct _fro_trim_record
+{
+    uint32_t magic;         /*!< FRO_TRIM_MAGIC when the record is valid. */
+    uint32_t oscillators;   /*!< Mask of clock_oscillator_t with a trim in the record. */
+    uint8_t froHfCoarse;    /*!< FRO_HF coarse trim. */
+    uint8_t froHfFine;      /*!< FRO_HF fine trim. */
+    uint8_t fro12MCoarse;   /*!< FRO12M CLTRIM. */
+    uint8_t fro12MFine;     /*!< FRO12M CCOTRIM. */
+    int32_t froHfErrorPpm;  /*!< FRO_HF residual error after calibration. */
+    int32_t fro12MErrorPpm; /*!< FRO12M residual error after calibration. */
+    uint32_t crc;           /*!< CRC-32 of all previous fields. */
+} fro_trim_record_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Applies the trims of the retained record, so a reset or a wake up does not calibrate again.
+ *
+ * Reads the factory trims first, so it must be called before anything changes a trim. A retained trim more
+ * than FRO_TRIM_MAX_FINE_DELTA steps away from the factory trim is not applied.
+ *
+ * @retval kStatus_Success The retained trims are applied.
+ * @retval kStatus_NoData No valid record or no retained trim near the factory trim, the FROs keep their current
+ *                        trim.
+ */
+status_t FRO_TRIM_Restore(void);
+
+/*!
+ * @brief Calibrates FROs against the clock_verify reference and keeps the good trims.
+ *
+ * Steps the fine trim of each oscillator from its current value until the measured error is below
+ * FRO_TRIM_TARGET_PPM. The trim slope is measured with a probe step, not assumed. A trim
+ * with a residual error above FRO_TRIM_ACCEPT_PPM, or more than FRO_TRIM_MAX_FINE_DELTA steps away from the
+ * factory trim, is not kept, the previous trim is applied again. The factory trims are read by the first
+ * FRO_TRIM_Restore() or FRO_TRIM_Calibrate() call. Prefer a crystal reference (kCLOCK_VERIFY_RefClkIn) when
+ * the board has one. Busy waits for the measurements, a few ms each. The oscillators must be running.
+ *
+ * @param oscillators Mask of clock_oscillator_t, kCLOCK_OscFroHf and kCLOCK_OscFro12M are handled.
+ * @retval kStatus_Success All oscillators have a good trim, saved in the retained record.
+ * @retval kStatus_Fail A calibration failed: no reference, no trim effect, residual error too large, or trim
+ *                      too far from the factory trim.
+ */
+status_t FRO_TRIM_Calibrate(uint32_t oscillators);
+
+/*!
+ * @brief Gets the retained record.
+ *
+ * @param record Copy of the record.
+ * @retval kStatus_Success The record is valid.
+ * @retval kStatus_NoData No valid record.
+ */
+status_t FRO_TRIM_GetRecord(fro_trim_record_t *record);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FRO_TRIM_H_ */
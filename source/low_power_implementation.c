@@ -17,6 +17,19 @@
 #include "fsl_wuu.h"
 #include "fsl_gpio.h"
 #include "fsl_port.h"
+#include "fsl_lptmr.h"
+#include "fsl_waketimer.h"
+#include "scheduler.h"
+#include "state_trace.h"
+#include "tracepoint.h"
+#include "crash_dump.h"
+#include "ctrl_protocol.h"
+#include "cmd_tokenizer.h"
+#include "periph_snapshot.h"
+#include "pin_park.h"
+#include "clock_verify.h"
+#include "fro_trim.h"
+#include "wkup_tune.h"
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
@@ -43,7 +56,7 @@
     {                                                                                                                    			\
         "Sleep Typical wake up time: ~0.27us, Power consumption: ~1.72mA",                                   						\
         "Sleep Fast wake up time: ~0.14us, Power consumption: ~3.27mA",                                      						\
-        "Sleep Slow wake up time: ~1.04us, Power consumption: ~0.82mA"                                       						\
+        "Sleep Slow wake up time: ~1.04us, Power consumption: ~0.82mA with FRO_HF running; FRO_HF is also stopped when no clocked peripheral uses it"	\
     }
 
 #define APP_DeepSleep_WAKE_DESC                                                                                          			\
@@ -75,6 +88,20 @@
 #define APP_WUU                         WUU0
 #define APP_WUU_WAKEUP_BUTTON_IDX       9U /* P1_7, SW3 on FRDM board. */
 #define APP_WUU_WAKEUP_BUTTON_NAME      "SW3"
+#define APP_WUU_WAKEUP_BUTTON_PORT      PORT1
+#define APP_WUU_WAKEUP_BUTTON_PIN       7U
+#define APP_WUU_WAKEUP_WAKETIMER_IDX    8U /* WAKETIMER0 internal module. */
+
+/* Low power Sleep cost model: Sleep currents of the Typical and Slow profiles from the results
+ * table, and an estimate of the Active current at 48MHz paid while FRO_HF starts again. */
+#define APP_SLEEP_TYPICAL_CURRENT_UA  1720U
+#define APP_SLEEP_SLOW_CURRENT_UA     820U
+#define APP_ACTIVE_48M_CURRENT_UA     4500U
+
+/* Wake up clock check: a sample within the tolerance ends the settling time. FREQME samples of
+ * 2 FRO16K clocks resolve about 170ppm at 48MHz. */
+#define APP_CLOCK_SETTLE_TOLERANCE_PPM 2000U
+#define APP_CLOCK_SETTLE_MAX_SAMPLES   16U
 
 /* LPUART RX */
 #define APP_DEBUG_CONSOLE_RX_PORT       PORT0
@@ -86,20 +113,72 @@
 #define APP_DEBUG_CONSOLE_TX_GPIO       GPIO0
 #define APP_DEBUG_CONSOLE_TX_PIN        3U
 #define APP_DEBUG_CONSOLE_TX_PINMUX     kPORT_MuxAlt2
+/* Debug console receive ring, a power of two. */
+#define APP_CONSOLE_RX_RING_SIZE        64U
+/* A menu line holds one key. */
+#define APP_CONSOLE_MAX_TOKENS          1U
+/* Key returned for a menu line that is not a single character, a blank is never part of a token. */
+#define APP_CONSOLE_INVALID_KEY         ((uint8_t)' ')
+/* Registers in s_consoleRegions. */
+#define APP_DEBUG_CONSOLE_SNAPSHOT_WORDS 2U
+
+#define APP_LPTMR                       LPTMR0
+#define APP_WAKETIMER                   WAKETIMER0
+/* Shortest idle period worth a DeepSleep entry, in 1 kHz ticks. */
+#define APP_IDLE_DEEP_SLEEP_MIN_TICKS   2U
+
+#define APP_TASK_PRIORITY_UI            3U
+#define APP_TASK_PRIORITY_TRIM          3U
+
+/* FRO calibration period, in 1 kHz ticks. */
+#define APP_FRO_TRIM_PERIOD_TICKS       (60U * 1000U)
+
+/* PowerDown Typical wake up delay for LDO recovery, used unless the board is tuned (WKUP_TUNE_ENABLE). */
+#define APP_POWER_DOWN_WAKE_DELAY       (0x5BU)
+/* Longest delay of the wake up delay tuning, the Slow wake up profile delay. */
+#define APP_WKUP_TUNE_MAX_DELAY         (0xFFU)
+/* Time in PowerDown of a tuning trial, in ms. */
+#define APP_WKUP_TUNE_DWELL_MS          2U
+/* Watchdog timeout of a tuning trial, in ms. */
+#define APP_WKUP_TUNE_WATCHDOG_MS       (500U)
+
+/* Longest dwell time a host can request, in ms. */
+#define APP_HOST_MAX_DWELL_MS           (24U * 60U * 60U * 1000U)
+
+/* Menu states of the UI task. */
+typedef enum _app_ui_state
+{
+    kAPP_UiPowerModeSelect,  /* Waiting for the power mode letter. */
+    kAPP_UiWakeUpModeSelect, /* Waiting for the wake up profile digit. */
+    kAPP_UiHostControl,      /* Bytes go to the host frame receiver. */
+} app_ui_state_t;
 
 #define Lowpower_Test_GPIO              GPIO3
 #define Lowpower_Test_GPIO_PIN          30U
+#define Lowpower_Test_GPIO_CLOCK        kCLOCK_GateGPIO3
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
 void APP_InitDebugConsole(void);
 void APP_DeinitDebugConsole(void);
 static void APP_SetSPCConfiguration(void);
+static void APP_InitTimebase(void);
+static uint32_t APP_GetTicks(void);
+static void APP_PowerModeSwitchTask(void *param);
+static void APP_FroTrimTask(void *param);
 static void APP_SetCMCConfiguration(void);
 
 static void APP_SelectWakeupSource(void);
 static void APP_GetWakeupConfig(app_power_mode_t targetMode);
 
+static void APP_ReportClockGates(void);
+static void APP_ReportLowPowerSleepCost(void);
+static void APP_VerifyClocks(void);
+static void APP_ReportWakeClock(void);
+static void APP_StartClockFRO96M(spc_core_ldo_voltage_level_t lowpowerLdoVoltage,
+                                 spc_core_ldo_drive_strength_t lowpowerLdoStrength);
+static void APP_TraceClockSwitch(void);
+static void APP_ReportClockSwitch(status_t status);
 static void APP_PowerPreSwitchHook(void);
 static void APP_PowerPostSwitchHook(void);
 
@@ -108,14 +187,34 @@ static void APP_EnterDeepSleepMode(void);
 static void APP_EnterPowerDownMode(void);
 static void APP_EnterDeepPowerDownMode(void);
 static void APP_PowerModeSwitch(app_power_mode_t targetPowerMode);
-static app_power_mode_t APP_GetTargetPowerMode(void);
-static app_wakeup_mode_t APP_GetWakeUpMode(app_power_mode_t targetPowerMode);
+static void APP_StartMenu(void);
+static void APP_FinishMenu(void);
+static void APP_PowerModeInput(uint8_t ch);
+static void APP_WakeUpModeInput(uint8_t ch);
+static void APP_ShowPowerModeMenu(void);
+static app_power_mode_t APP_GetTargetPowerMode(uint8_t ch);
+static void APP_ShowWakeUpModeMenu(app_power_mode_t targetPowerMode);
+static bool APP_GetWakeUpMode(app_power_mode_t targetPowerMode, uint8_t ch, app_wakeup_mode_t *wakeUpMode);
+static bool APP_ConsoleGetKey(uint8_t *ch);
+static void APP_EnableConsoleInput(void);
 static void APP_SetWakeUpMode(app_power_mode_t targetPowerMode, app_wakeup_mode_t targetWakeMode);
 static void APP_SetSleepWakeUpMode(app_wakeup_mode_t targetWakeMode);
 static void APP_SetDeepSleepWakeUpMode(app_wakeup_mode_t targetWakeMode);
 static void APP_SetPowerDownWakeUpMode(app_wakeup_mode_t targetWakeMode);
 static void APP_SetDeepPowerDownWakeUpMode(app_wakeup_mode_t targetWakeMode);
 
+#if (defined(WKUP_TUNE_ENABLE) && (WKUP_TUNE_ENABLE > 0U))
+static void APP_TuneWakeUpDelay(void);
+static void APP_WkupTuneWatchdogStart(void);
+static void APP_WkupTuneWatchdogFeed(void);
+static status_t APP_WkupTuneTrial(uint16_t delay, void *userData);
+#endif
+
+static void APP_HostControlInput(uint8_t ch);
+static bool APP_HostExecute(const ctrl_frame_t *request, uint8_t *response, uint32_t *responseLength);
+static uint8_t APP_HostRunCycles(const ctrl_cycle_request_t *request, ctrl_cycle_telemetry_t *telemetry);
+static void APP_HostSendFrame(const uint8_t *frame, uint32_t length);
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
@@ -128,6 +227,86 @@ char *const g_DeepSleepWakeArray[] = APP_DeepSleep_WAKE_DESC;
 char *const g_PowerDownWakeArray[] = APP_PowerDown_WAKE_DESC;
 char *const g_DeepPowerDownWakeArray[] = APP_DeepPowerDown_WAKE_DESC;
 
+EVENT_QUEUE_DEFINE(appEventQueue, APP_EVENT_QUEUE_CAPACITY);
+event_queue_t g_appEventQueue;
+
+static sched_task_t s_powerModeSwitchTask;
+static app_ui_state_t s_uiState;
+static app_power_mode_t s_targetPowerMode;
+
+/* Debug console bytes received by BOARD_UART_IRQ_HANDLER: menu lines, or host frames after a NUL. */
+static uint8_t s_consoleRxBuffer[APP_CONSOLE_RX_RING_SIZE];
+static cmd_token_t s_consoleTokens[APP_CONSOLE_MAX_TOKENS];
+static cmd_tokenizer_t s_consoleTokenizer;
+static sched_task_t s_froTrimTask;
+
+/* Debug console pins restored after wake up instead of running BOARD_InitPins. The clocks and the
+ * LPUART go through their drivers: the console is deinitialized in low power modes. */
+static const snapshot_region_t s_consoleRegions[] = {
+    /* P0_2 RX and P0_3 TX. */
+    SNAPSHOT_REGION(PORT0_BASE, PORT_Type, PCR[APP_DEBUG_CONSOLE_RX_PIN], 2U),
+};
+static uint32_t s_consoleSnapshotStorage[APP_DEBUG_CONSOLE_SNAPSHOT_WORDS];
+
+/* Ports whose pins are parked in low power modes, with the pins that must keep their function. */
+static const pin_park_port_t s_pinParkPorts[] = {
+    /* P0_0 SWDIO, P0_1 SWCLK. */
+    {PORT0, kCLOCK_GatePORT0, (1UL << 0U) | (1UL << 1U)},
+    /* P1_29 RESET_b. */
+    {PORT1, kCLOCK_GatePORT1, (1UL << 29U)},
+    {PORT2, kCLOCK_GatePORT2, 0U},
+    /* Wake up time measurement output. */
+    {PORT3, kCLOCK_GatePORT3, (1UL << Lowpower_Test_GPIO_PIN)},
+};
+
+/* Debug console pins in low power modes: BOARD_InitPins settings with the pin function disabled. */
+static const port_pin_group_t s_consoleParkedPins[] = {
+    {APP_DEBUG_CONSOLE_RX_PORT,
+     (1UL << APP_DEBUG_CONSOLE_RX_PIN) | (1UL << APP_DEBUG_CONSOLE_TX_PIN),
+     {kPORT_PullUp, kPORT_LowPullResistor, kPORT_FastSlewRate, kPORT_PassiveFilterDisable, kPORT_OpenDrainDisable,
+      kPORT_LowDriveStrength, kPORT_NormalDriveStrength, kPORT_PinDisabledOrAnalog, kPORT_InputBufferEnable,
+      kPORT_InputNormal, kPORT_UnlockRegister}},
+};
+static snapshot_t s_consoleSnapshot;
+
+static ctrl_receiver_t s_hostReceiver;
+/* Last host control response, sent again when the host retries with the same sequence number. */
+static uint8_t s_hostResponse[CTRL_MAX_ENCODED_FRAME];
+static uint32_t s_hostResponseLength;
+static uint8_t s_hostResponseSeq;
+
+/* Clock gates closed by APP_PowerModeSwitch, reopened on wake up. */
+static clock_gate_audit_t s_lowPowerGates;
+
+/* Sleep with the Slow wake up profile also stops FRO_HF. */
+static bool s_sleepStopFroHf;
+/* FRO_HF was stopped by the last Sleep entry. */
+static bool s_froHfStopped;
+/* Core cycles of the last FRO_HF restart, the measured cost of the low power Sleep profile. */
+static uint32_t s_froHfRestartCycles;
+/* Core clock the restart started from, FRO12M, the restart cycles are counted in its cycles. */
+static uint32_t s_froHfRestartCoreFreq;
+
+/* Check the main clock oscillator as soon as the low power mode exits, menu path only. */
+static bool s_clockVerifyOnWake;
+static clock_verify_target_t s_wakeClockTarget;
+static status_t s_wakeClockStatus;
+static clock_verify_settle_t s_wakeClockSettle;
+/* Core clock of the wake up profile, the settling time is counted in its cycles. */
+static uint32_t s_wakeClockCoreFreq;
+
+/* Switch to the Fast wake up profile clock, the voltage ramps while the wake up source is set up. */
+static board_clock_step_t s_clockStep;
+
+/* LPWKUP_DELAY of the PowerDown Typical wake up profile, tuned for this board. */
+static uint16_t s_powerDownWakeDelay = APP_POWER_DOWN_WAKE_DELAY;
+
+static const sched_config_t s_schedConfig = {
+    .getTicks   = APP_GetTicks,
+    .idle       = APP_IdleHook,
+    .eventQueue = &g_appEventQueue,
+};
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -137,25 +316,42 @@ void APP_InitDebugConsole(void)
      * Debug console RX pin is set to disable for current leakage, need to re-configure pinmux.
      * Debug console TX pin: Don't need to change.
      */
-    BOARD_InitPins();
-    BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength, 
-                          kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
+    uint32_t traceState = BOARD_StateTraceSet((uint32_t)kSTATE_TRACE_ConsoleInit);
+    status_t status;
+
+    /* On failure the console runs on the clock in effect, its baud rate follows the clock driver. */
+    (void)BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength, 
+                                kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
+    /* Write back the pin settings saved by APP_DeinitDebugConsole instead of running BOARD_InitPins. */
+    CLOCK_RequestClock(kCLOCK_GatePORT0);
+    status = SNAPSHOT_Restore(&s_consoleSnapshot);
+    CLOCK_ReleaseClock(kCLOCK_GatePORT0);
+    if (status != kStatus_Success)
+    {
+        BOARD_InitPins();
+    }
+    /* Reuses the LPUART baud rate divisors found at boot. */
     BOARD_InitDebugConsole();
+    APP_EnableConsoleInput();
+    TRACEPOINT(TRACEPOINT_ID(kTRACEPOINT_ConsoleInit, 0U));
+    (void)BOARD_StateTraceSet(traceState);
 }
 
 void APP_DeinitDebugConsole(void)
 {
+    TRACEPOINT(TRACEPOINT_ID(kTRACEPOINT_ConsoleDeinit, 0U));
+    SNAPSHOT_Save(&s_consoleSnapshot);
+    /* Waits for the last character, disables the LPUART and gates its clock. */
     DbgConsole_Deinit();
-    PORT_SetPinMux(APP_DEBUG_CONSOLE_RX_PORT, APP_DEBUG_CONSOLE_RX_PIN, kPORT_PinDisabledOrAnalog);
-    PORT_SetPinMux(APP_DEBUG_CONSOLE_TX_PORT, APP_DEBUG_CONSOLE_TX_PIN, kPORT_PinDisabledOrAnalog);
+    /* RX and TX are on the same port: one GPCLR write. */
+    PORT_SetPinGroupsConfig(s_consoleParkedPins, ARRAY_SIZE(s_consoleParkedPins));
 }
 
 void main(void)
 {
-    uint32_t freq;
-    app_power_mode_t targetPowerMode;
-    app_wakeup_mode_t targetWakeMode;
-    bool needSetWakeup = false;
+    uint32_t tracedRecords;
+    uint32_t trimDelay;
+    spc_busy_wait_record_t spcBusyWait;
 
     RESET_PeripheralReset(kLPUART0_RST_SHIFT_RSTn);
     RESET_PeripheralReset(kPORT0_RST_SHIFT_RSTn);
@@ -164,10 +360,24 @@ void main(void)
     BOARD_InitPins();
     BOARD_InitBootClocks();
     BOARD_InitDebugConsole();
+    SNAPSHOT_Init(&s_consoleSnapshot, s_consoleRegions, ARRAY_SIZE(s_consoleRegions), s_consoleSnapshotStorage,
+                  ARRAY_SIZE(s_consoleSnapshotStorage));
+    PIN_PARK_Init(s_pinParkPorts, ARRAY_SIZE(s_pinParkPorts));
+    /* Cycle counter for the wake up cost measurements. */
+    MSDK_EnableCpuCycleCounter();
+
+    EVENT_QUEUE_Init(&g_appEventQueue, EVENT_QUEUE_SLOTS(appEventQueue), APP_EVENT_QUEUE_CAPACITY);
     
-    /* Init GPIO for measure wake up time */
+    /* Init GPIO for measure wake up time, its clock is held: the pin is driven across low power modes. */
     gpio_pin_config_t gpio_config = {kGPIO_DigitalOutput, 0};
+    CLOCK_RequestClock(Lowpower_Test_GPIO_CLOCK);
     GPIO_PinInit(Lowpower_Test_GPIO, Lowpower_Test_GPIO_PIN, &gpio_config);
+    BOARD_InitStateTrace();
+#if (defined(BOARD_STATE_TRACE_ENABLE) && (BOARD_STATE_TRACE_ENABLE > 0U))
+    PIN_PARK_Keep(BOARD_STATE_TRACE_PORT, BOARD_STATE_TRACE_MASK << BOARD_STATE_TRACE_FIRST_PIN);
+#endif
+    tracedRecords = TRACEPOINT_Init();
+    TRACEPOINT(TRACEPOINT_ID(kTRACEPOINT_Boot, CMC_GetSystemResetStatus(APP_CMC)));
 
     /* Release the I/O pads and certain peripherals to normal run mode state, for in Power Down mode
      * they will be in a latched state. */
@@ -184,59 +394,353 @@ void main(void)
     NVIC_ClearPendingIRQ(Reserved16_IRQn);                                               
 
     PRINTF("\r\nNormal Boot.\r\n");
+    (void)CRASH_DUMP_Report();
+    /* Regulator changes of the boot clock setup and of APP_SetSPCConfiguration(). */
+    SPC_GetBusyWaitRecord(&spcBusyWait);
+    PRINTF("SPC busy waits: %u, last %u us, max %u us, %u timeouts\r\n", spcBusyWait.count, spcBusyWait.lastUs,
+           spcBusyWait.maxUs, spcBusyWait.timeouts);
+
+    /* After a warm reset (pin, watchdog, lockup...), show what led to it. */
+    if ((tracedRecords != 0U) && ((CMC_GetSystemResetStatus(APP_CMC) & kCMC_WarmReset) != 0UL))
+    {
+        PRINTF("\r\nTrace before reset:");
+        TRACEPOINT_Dump();
+    }
 
-    while (1)
+    APP_InitTimebase();
+    /* A crystal on CLK_IN is the better reference, else FRO16K which runs from APP_InitTimebase on. */
+    if (CLOCK_GetFreq(kCLOCK_ExtClk) != 0U)
+    {
+        CLOCK_VERIFY_Init(kCLOCK_VERIFY_RefClkIn, 0U);
+    }
+    else
     {
-        GPIO_PortClear(Lowpower_Test_GPIO, 1 << Lowpower_Test_GPIO_PIN);
-        if ((CMC_GetSystemResetStatus(APP_CMC) & kCMC_WakeUpReset) != 0UL)
+        CLOCK_VERIFY_Init(kCLOCK_VERIFY_RefClk16K, 0U);
+    }
+    /* A trim retained from before the reset is used until the next calibration period. */
+    trimDelay = (FRO_TRIM_Restore() == kStatus_Success) ? APP_FRO_TRIM_PERIOD_TICKS : 0U;
+    APP_VerifyClocks();
+#if (defined(WKUP_TUNE_ENABLE) && (WKUP_TUNE_ENABLE > 0U))
+    APP_TuneWakeUpDelay();
+#endif
+    SCHED_Init(&s_schedConfig);
+    (void)SCHED_CreateTask(&s_froTrimTask, APP_FroTrimTask, NULL, APP_TASK_PRIORITY_TRIM);
+    SCHED_ActivateAfter(&s_froTrimTask, trimDelay, APP_FRO_TRIM_PERIOD_TICKS);
+    (void)SCHED_CreateTask(&s_powerModeSwitchTask, APP_PowerModeSwitchTask, NULL, APP_TASK_PRIORITY_UI);
+    APP_StartMenu();
+    CMD_TokenizerInit(&s_consoleTokenizer, s_consoleRxBuffer, sizeof(s_consoleRxBuffer), s_consoleTokens,
+                      APP_CONSOLE_MAX_TOKENS);
+    APP_EnableConsoleInput();
+
+    SCHED_Run();
+}
+
+/* UI task, runs once for each menu line or host control byte received on the debug console. */
+static void APP_PowerModeSwitchTask(void *param)
+{
+    uint8_t ch;
+
+    if (s_uiState == kAPP_UiHostControl)
+    {
+        if (!CMD_TokenizerGetByte(&s_consoleTokenizer, &ch))
         {
-            /* Close ISO flags. */
-            SPC_ClearPeriphIOIsolationFlag(APP_SPC);
+            return;
         }
+    }
+    else if (!APP_ConsoleGetKey(&ch))
+    {
+        return;
+    }
+
+    switch (s_uiState)
+    {
+        case kAPP_UiPowerModeSelect:
+            APP_PowerModeInput(ch);
+            break;
+        case kAPP_UiWakeUpModeSelect:
+            APP_WakeUpModeInput(ch);
+            break;
+        case kAPP_UiHostControl:
+            APP_HostControlInput(ch);
+            break;
+        default:
+            assert(false);
+            break;
+    }
 
-        /* Clear CORE_MAIN power domain's low power request flag. */
-        SPC_ClearPowerDomainLowPowerRequestFlag(APP_SPC, APP_SPC_MAIN_POWER_DOMAIN);
-        SPC_ClearLowPowerRequest(APP_SPC);
+    /* One input per activation: the other tasks and the idle hook run in between. A partial menu
+     * line leaves the task idle, the end of line activates it again. */
+    if (CMD_TokenizerGetPendingCount(&s_consoleTokenizer) != 0U)
+    {
+        SCHED_Activate(&s_powerModeSwitchTask);
+    }
+}
 
-        /* Normal start. */
-        APP_SetCMCConfiguration();
+/* Prints the demo banner and the power mode menu. */
+static void APP_StartMenu(void)
+{
+    uint32_t freq;
 
-        freq = CLOCK_GetFreq(kCLOCK_CoreSysClk);
-        PRINTF("\r\n###########################    Low Power Implementation Demo    ###########################\r\n");
-        PRINTF("    Core Clock = %dHz \r\n", freq);
-        PRINTF("    Power mode: Active\r\n");
-        targetPowerMode = APP_GetTargetPowerMode();
+    GPIO_PortClear(Lowpower_Test_GPIO, 1 << Lowpower_Test_GPIO_PIN);
+    if ((CMC_GetSystemResetStatus(APP_CMC) & kCMC_WakeUpReset) != 0UL)
+    {
+        /* Close ISO flags. */
+        SPC_ClearPeriphIOIsolationFlag(APP_SPC);
+    }
+
+    /* Clear CORE_MAIN power domain's low power request flag. */
+    SPC_ClearPowerDomainLowPowerRequestFlag(APP_SPC, APP_SPC_MAIN_POWER_DOMAIN);
+    SPC_ClearLowPowerRequest(APP_SPC);
+
+    /* Normal start. */
+    APP_SetCMCConfiguration();
+
+    freq = CLOCK_GetFreq(kCLOCK_CoreSysClk);
+    PRINTF("\r\n###########################    Low Power Implementation Demo    ###########################\r\n");
+    PRINTF("    Core Clock = %dHz \r\n", freq);
+    PRINTF("    Power mode: Active\r\n");
+    APP_ShowPowerModeMenu();
+    s_uiState = kAPP_UiPowerModeSelect;
+}
+
+/* Ends a menu pass, the menu is shown again. */
+static void APP_FinishMenu(void)
+{
+    PRINTF("\r\nNext loop.\r\n");
+    APP_StartMenu();
+}
+
+static void APP_PowerModeInput(uint8_t ch)
+{
+    /* Host frames start with a delimiter, never typed on a terminal. */
+    if (ch == CTRL_FRAME_DELIMITER)
+    {
+        CTRL_ReceiverInit(&s_hostReceiver);
+        s_hostResponseLength = 0U;
+        s_uiState            = kAPP_UiHostControl;
+        return;
+    }
+
+    s_targetPowerMode = APP_GetTargetPowerMode(ch);
+    if (s_targetPowerMode == kAPP_PowerModeMax)
+    {
+        APP_ShowPowerModeMenu();
+        return;
+    }
+
+    /* If target mode is Active mode, don't need to set wakeup source. */
+    if (s_targetPowerMode == kAPP_PowerModeActive)
+    {
+        APP_FinishMenu();
+        return;
+    }
+
+    APP_ShowWakeUpModeMenu(s_targetPowerMode);
+    s_uiState = kAPP_UiWakeUpModeSelect;
+}
+
+static void APP_WakeUpModeInput(uint8_t ch)
+{
+    app_power_mode_t targetPowerMode = s_targetPowerMode;
+    app_wakeup_mode_t targetWakeMode;
+
+    if (!APP_GetWakeUpMode(targetPowerMode, ch, &targetWakeMode))
+    {
+        APP_ShowWakeUpModeMenu(targetPowerMode);
+        return;
+    }
+
+    /* configure the wake up mode*/
+    APP_SetWakeUpMode(targetPowerMode, targetWakeMode);
+    /* select and configure the wake up source */
+    APP_GetWakeupConfig(targetPowerMode);
+    APP_ReportClockGates();
+    s_clockVerifyOnWake = true;
+    APP_PowerPreSwitchHook();
+    /* enter different low power mode */
+    APP_PowerModeSwitch(targetPowerMode);
+    APP_PowerPostSwitchHook();
+    s_clockVerifyOnWake = false;
+    APP_ReportWakeClock();
+    if ((targetPowerMode == kAPP_PowerModeSleep) && s_sleepStopFroHf)
+    {
+        APP_ReportLowPowerSleepCost();
+    }
+
+    APP_FinishMenu();
+}
+
+/*
+ * Takes the next menu line, main context only. A line of one character is a key, any other line
+ * gives APP_CONSOLE_INVALID_KEY. A NUL, the start of a host frame, is returned as it is.
+ */
+static bool APP_ConsoleGetKey(uint8_t *ch)
+{
+    uint32_t count;
+    status_t status = CMD_TokenizerGetLine(&s_consoleTokenizer, &count);
+
+    if (status == kStatus_NoData)
+    {
+        return false;
+    }
+    if (status == kStatus_Busy)
+    {
+        return CMD_TokenizerGetByte(&s_consoleTokenizer, ch);
+    }
+
+    *ch = APP_CONSOLE_INVALID_KEY;
+    if ((status == kStatus_Success) && (count == 1U) && (s_consoleTokens[0].length == 1U))
+    {
+        *ch = (uint8_t)CMD_TokenCharAt(&s_consoleTokenizer, &s_consoleTokens[0], 0U);
+    }
+    /* Nothing to release after kStatus_Fail, the overlong line is already dropped. */
+    CMD_TokenizerReleaseLine(&s_consoleTokenizer);
+
+    return true;
+}
 
-        if ((targetPowerMode > kAPP_PowerModeMin) && (targetPowerMode < kAPP_PowerModeMax))
+/* Enables the debug console receive interrupt, again after each console initialization. */
+static void APP_EnableConsoleInput(void)
+{
+    LPUART_EnableInterrupts((LPUART_Type *)BOARD_DEBUG_UART_BASEADDR,
+                            (uint32_t)kLPUART_RxDataRegFullInterruptEnable |
+                                (uint32_t)kLPUART_RxOverrunInterruptEnable);
+    EnableIRQ(BOARD_UART_IRQ);
+}
+
+/*
+ * Pushes the received bytes to the console tokenizer. The UI task is activated when the ring was
+ * empty or a line ends; it activates itself again while bytes are left, so a host frame burst needs
+ * one activation.
+ */
+void BOARD_UART_IRQ_HANDLER(void)
+{
+    LPUART_Type *base = (LPUART_Type *)BOARD_DEBUG_UART_BASEADDR;
+    bool activate     = (CMD_TokenizerGetPendingCount(&s_consoleTokenizer) == 0U);
+    uint8_t data;
+
+    if ((LPUART_GetStatusFlags(base) & (uint32_t)kLPUART_RxOverrunFlag) != 0U)
+    {
+        (void)LPUART_ClearStatusFlags(base, (uint32_t)kLPUART_RxOverrunFlag);
+    }
+
+    while ((LPUART_GetStatusFlags(base) & (uint32_t)kLPUART_RxDataRegFullFlag) != 0U)
+    {
+        data = LPUART_ReadByte(base);
+        if (CMD_TokenizerPutFromISR(&s_consoleTokenizer, data) &&
+            ((data == (uint8_t)'\r') || (data == (uint8_t)'\n') || (data == CTRL_FRAME_DELIMITER)))
+        {
+            activate = true;
+        }
+    }
+
+    if (activate && (CMD_TokenizerGetPendingCount(&s_consoleTokenizer) != 0U))
+    {
+        (void)SCHED_ActivateFromISR(&s_powerModeSwitchTask);
+    }
+    SDK_ISR_EXIT_BARRIER;
+}
+
+/* Runs while the menu waits for input, the UI task only runs when a byte is received. */
+static void APP_FroTrimTask(void *param)
+{
+    fro_trim_record_t record;
+
+    if (FRO_TRIM_Calibrate((uint32_t)kCLOCK_OscFroHf | (uint32_t)kCLOCK_OscFro12M) != kStatus_Success)
+    {
+        PRINTF("FRO trim: calibration failed, previous trim kept\r\n");
+    }
+    if (FRO_TRIM_GetRecord(&record) == kStatus_Success)
+    {
+        PRINTF("FRO trim: FRO_HF 0x%02x/0x%02x (%d ppm), FRO12M 0x%02x/0x%02x (%d ppm)\r\n", record.froHfCoarse,
+               record.froHfFine, record.froHfErrorPpm, record.fro12MCoarse, record.fro12MFine,
+               record.fro12MErrorPpm);
+    }
+}
+
+static void APP_InitTimebase(void)
+{
+    lptmr_config_t lptmrConfig;
+    waketimer_config_t waketimerConfig;
+
+    /* FRO16K feeds both LPTMR and WAKETIMER and keeps running in all low power modes. */
+    (void)CLOCK_SetupFRO16KClocking((uint8_t)(kCLKE_16K_SYSTEM | kCLKE_16K_COREMAIN));
+
+    /* Free running 1 kHz tick counter: clk_16k divided by 16. */
+    LPTMR_GetDefaultConfig(&lptmrConfig);
+    lptmrConfig.enableFreeRunning    = true;
+    lptmrConfig.bypassPrescaler      = false;
+    lptmrConfig.prescalerClockSource = kLPTMR_PrescalerClock_1;
+    lptmrConfig.value                = kLPTMR_Prescale_Glitch_3;
+    LPTMR_Init(APP_LPTMR, &lptmrConfig);
+    LPTMR_StartTimer(APP_LPTMR);
+
+    /* One shot wake up timer, counts 1 kHz ticks with the OSC divider. */
+    WAKETIMER_GetDefaultConfig(&waketimerConfig);
+    WAKETIMER_Init(APP_WAKETIMER, &waketimerConfig);
+}
+
+static uint32_t APP_GetTicks(void)
+{
+    return LPTMR_GetCurrentTimerCount(APP_LPTMR);
+}
+
+void APP_IdleHook(uint32_t ticksToWakeUp)
+{
+    bool deepSleep      = (ticksToWakeUp >= APP_IDLE_DEEP_SLEEP_MIN_TICKS);
+    uint32_t traceState = BOARD_StateTraceSet((uint32_t)kSTATE_TRACE_Idle);
+
+    TRACEPOINT(TRACEPOINT_ID(kTRACEPOINT_Idle, ticksToWakeUp));
+
+    if (ticksToWakeUp != SCHED_NO_DEADLINE)
+    {
+        WAKETIMER_StartTimer(APP_WAKETIMER, (ticksToWakeUp == 0U) ? 1U : ticksToWakeUp);
+    }
+    if (deepSleep)
+    {
+        /* Bus clocks are gated in DeepSleep, let the console finish first. */
+        while (!(kLPUART_TransmissionCompleteFlag & LPUART_GetStatusFlags((LPUART_Type *)BOARD_DEBUG_UART_BASEADDR)))
         {
-            /* If target mode is Active mode, don't need to set wakeup source. */
-            if (targetPowerMode == kAPP_PowerModeActive)
-            {
-                needSetWakeup = false;
-            }
-            else
-            {
-                needSetWakeup = true;
-            }
         }
+    }
+
+    /* Mask interrupts: an ISR posting after the empty check stays pending and
+     * makes the WFI below return immediately instead of losing the event. */
+    CMC_PreEnterLowPowerMode();
 
-        /* Print description of selected power mode. */
-        if (needSetWakeup)
-        {       
-            /* select the wake up mode */
-            targetWakeMode = APP_GetWakeUpMode(targetPowerMode);
-            /* configure the wake up mode*/
-            APP_SetWakeUpMode(targetPowerMode, targetWakeMode);
-            /* select and configure the wake up source */
-            APP_GetWakeupConfig(targetPowerMode);
-            APP_PowerPreSwitchHook();
-            /* enter different low power mode */
-            APP_PowerModeSwitch(targetPowerMode);
-            APP_PowerPostSwitchHook();
+    if (EVENT_QUEUE_IsEmpty(&g_appEventQueue))
+    {
+        if (deepSleep)
+        {
+            /* The debug console keeps its clock: a received byte wakes the UI task. */
+            CLOCK_SetLowPowerOscillators(CLOCK_GetRequiredOscillators(false));
+            CMC_SetClockMode(APP_CMC, kCMC_GateAllSystemClocksEnterLowPowerMode);
+            CMC_SetMAINPowerMode(APP_CMC, kCMC_DeepSleepMode);
+        }
+        else
+        {
+            CMC_SetClockMode(APP_CMC, kCMC_GateNoneClock);
+            CMC_SetMAINPowerMode(APP_CMC, kCMC_ActiveOrSleepMode);
         }
+        /* Read back the last register to ensure all writes have completed. */
+        (void)APP_CMC->PMCTRL[0];
+        SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+        (void)BOARD_StateTraceSet((uint32_t)kSTATE_TRACE_ModeEntry);
+        __DSB();
+        __WFI();
+        (void)BOARD_StateTraceSet((uint32_t)kSTATE_TRACE_WakeUp);
+    }
 
-        PRINTF("\r\nNext loop.\r\n");
+    /* Woken early by another source: drop the pending timeout. */
+    WAKETIMER_HaltTimer(APP_WAKETIMER);
+    if (deepSleep)
+    {
+        CLOCK_SetLowPowerOscillators(0U);
     }
+
+    /* Pending ISRs run here and may post new events. */
+    CMC_PostExitLowPowerMode();
+    (void)BOARD_StateTraceSet(traceState);
 }
 
 static void APP_SetSPCConfiguration(void)
@@ -267,8 +771,10 @@ static void APP_SetSPCConfiguration(void)
         PRINTF("Fail to set regulators in Active mode.");
         return;
     }
-    while (SPC_GetBusyStatusFlag(APP_SPC))
-        ;
+    if (SPC_WaitBusyStatusFlagClear(APP_SPC) != kStatus_Success)
+    {
+        PRINTF("SPC still busy after regulator change in Active mode.\r\n");
+    }
 
     SPC_DisableLowPowerModeAnalogModules(APP_SPC, kSPC_controlAllModules);
     SPC_SetLowPowerWakeUpDelay(APP_SPC, 0xFF);
@@ -287,8 +793,10 @@ static void APP_SetSPCConfiguration(void)
         PRINTF("Fail to set regulators in Low Power Mode.");
         return;
     }
-    while (SPC_GetBusyStatusFlag(APP_SPC))
-        ;
+    if (SPC_WaitBusyStatusFlagClear(APP_SPC) != kStatus_Success)
+    {
+        PRINTF("SPC still busy after regulator change in Low Power Mode.\r\n");
+    }
 }
 
 static void APP_SetCMCConfiguration(void)
@@ -304,36 +812,35 @@ static void APP_SetCMCConfiguration(void)
     CMC_ConfigFlashMode(APP_CMC, false, true, false);
 }
 
-static app_power_mode_t APP_GetTargetPowerMode(void)
+static void APP_ShowPowerModeMenu(void)
 {
-    uint8_t ch;
-
-    app_power_mode_t inputPowerMode;
-
-    do
+    PRINTF("\r\nSelect the desired operation \n\r\n");
+    for (app_power_mode_t modeIndex = kAPP_PowerModeActive; modeIndex <= kAPP_PowerModeDeepPowerDown; modeIndex++)
     {
-        PRINTF("\r\nSelect the desired operation \n\r\n");
-        for (app_power_mode_t modeIndex = kAPP_PowerModeActive; modeIndex <= kAPP_PowerModeDeepPowerDown; modeIndex++)
-        {
-            PRINTF("\tPress %c to enter: %s mode\r\n", modeIndex,
-                   g_modeNameArray[(uint8_t)(modeIndex - kAPP_PowerModeActive)]);
-        }
+        PRINTF("\tPress %c to enter: %s mode\r\n", modeIndex,
+               g_modeNameArray[(uint8_t)(modeIndex - kAPP_PowerModeActive)]);
+    }
 
-        PRINTF("\r\nWaiting for power mode select...\r\n\r\n");
+    PRINTF("\tSend a framed command to enter host control mode\r\n");
+    PRINTF("\r\nWaiting for power mode select, end it with Enter...\r\n\r\n");
+}
 
-        ch = GETCHAR();
+/* Returns kAPP_PowerModeMax for a wrong input. */
+static app_power_mode_t APP_GetTargetPowerMode(uint8_t ch)
+{
+    app_power_mode_t inputPowerMode;
 
-        if ((ch >= 'a') && (ch <= 'z'))
-        {
-            ch -= 'a' - 'A';
-        }
-        inputPowerMode = (app_power_mode_t)ch;
+    if ((ch >= 'a') && (ch <= 'z'))
+    {
+        ch -= 'a' - 'A';
+    }
+    inputPowerMode = (app_power_mode_t)ch;
 
-        if ((inputPowerMode > kAPP_PowerModeDeepPowerDown) || (inputPowerMode < kAPP_PowerModeActive))
-        {
-            PRINTF("Wrong Input!");
-        }
-    } while (inputPowerMode > kAPP_PowerModeDeepPowerDown);
+    if ((inputPowerMode > kAPP_PowerModeDeepPowerDown) || (inputPowerMode < kAPP_PowerModeActive))
+    {
+        PRINTF("Wrong Input!");
+        return kAPP_PowerModeMax;
+    }
 
     PRINTF("\tPress %c and select %s mode\r\n", inputPowerMode, g_modeNameArray[(uint8_t)(inputPowerMode - kAPP_PowerModeActive)]);
     PRINTF("\t%s\r\n", g_modeDescArray[(uint8_t)(inputPowerMode - kAPP_PowerModeActive)]);
@@ -341,78 +848,54 @@ static app_power_mode_t APP_GetTargetPowerMode(void)
     return inputPowerMode;
 }
 
-static app_wakeup_mode_t APP_GetWakeUpMode(app_power_mode_t targetPowerMode)
+static void APP_ShowWakeUpModeMenu(app_power_mode_t targetPowerMode)
 {
-    uint8_t ch;
-
-    app_wakeup_mode_t wakeUpMode;
-    
-    if(targetPowerMode < kAPP_PowerModeDeepPowerDown)
-    {
-        do
-        {
-            PRINTF("\r\nSelect the wake up mode \n\r\n");
-
-            for (app_wakeup_mode_t modeIndex = kAPP_TypicalWakeUp; modeIndex <= kAPP_SlowWakeUp; modeIndex++)
-            {
-                PRINTF("\tPress %c to select: %s mode\r\n", modeIndex,
-                       g_modeWakeArray[(uint8_t)(modeIndex - kAPP_TypicalWakeUp)]);
-            }
+    /* DeepPowerDown has the Typical wake up profile only. */
+    app_wakeup_mode_t lastMode = (targetPowerMode < kAPP_PowerModeDeepPowerDown) ? kAPP_SlowWakeUp : kAPP_TypicalWakeUp;
 
-            PRINTF("\r\nWaiting for wake up mode select...\r\n\r\n");
+    PRINTF("\r\nSelect the wake up mode \n\r\n");
 
-            ch = GETCHAR();
-            wakeUpMode = (app_wakeup_mode_t)ch;
-            
-            if ((wakeUpMode > kAPP_SlowWakeUp) || (wakeUpMode < kAPP_TypicalWakeUp))
-            {
-                PRINTF("Wrong Input!");
-            }
-        } while (wakeUpMode > kAPP_SlowWakeUp || wakeUpMode < kAPP_TypicalWakeUp);
-    }
-    else
+    for (app_wakeup_mode_t modeIndex = kAPP_TypicalWakeUp; modeIndex <= lastMode; modeIndex++)
     {
-        do
-        {
-            PRINTF("\r\nSelect the wake up mode \n\r\n");
+        PRINTF("\tPress %c to select: %s mode\r\n", modeIndex,
+               g_modeWakeArray[(uint8_t)(modeIndex - kAPP_TypicalWakeUp)]);
+    }
 
-            for (app_wakeup_mode_t modeIndex = kAPP_TypicalWakeUp; modeIndex <= kAPP_TypicalWakeUp; modeIndex++)
-            {
-                PRINTF("\tPress %c to select: %s mode\r\n", modeIndex,
-                       g_modeWakeArray[(uint8_t)(modeIndex - kAPP_TypicalWakeUp)]);
-            }
+    PRINTF("\r\nWaiting for wake up mode select, end it with Enter...\r\n\r\n");
+}
 
-            PRINTF("\r\nWaiting for wake up mode select...\r\n\r\n");
+/* Returns false for a wrong input. */
+static bool APP_GetWakeUpMode(app_power_mode_t targetPowerMode, uint8_t ch, app_wakeup_mode_t *wakeUpMode)
+{
+    app_wakeup_mode_t lastMode = (targetPowerMode < kAPP_PowerModeDeepPowerDown) ? kAPP_SlowWakeUp : kAPP_TypicalWakeUp;
 
-            ch = GETCHAR();
-            wakeUpMode = (app_wakeup_mode_t)ch;
-            
-            if (wakeUpMode != kAPP_TypicalWakeUp)
-            {
-                PRINTF("Wrong Input!");
-            }
-        } while (wakeUpMode != kAPP_TypicalWakeUp);
+    *wakeUpMode = (app_wakeup_mode_t)ch;
+    if ((*wakeUpMode > lastMode) || (*wakeUpMode < kAPP_TypicalWakeUp))
+    {
+        PRINTF("Wrong Input!");
+        return false;
     }
-    PRINTF("\tPress %c and select %s mode\r\n", wakeUpMode, g_modeWakeArray[(uint8_t)(wakeUpMode - kAPP_TypicalWakeUp)]);
+
+    PRINTF("\tPress %c and select %s mode\r\n", *wakeUpMode, g_modeWakeArray[(uint8_t)(*wakeUpMode - kAPP_TypicalWakeUp)]);
     switch (targetPowerMode)
     {
         case kAPP_PowerModeSleep:
-            PRINTF("\t%s\n\r\n", g_SleepWakeArray[(uint8_t)(wakeUpMode - kAPP_TypicalWakeUp)]);
+            PRINTF("\t%s\n\r\n", g_SleepWakeArray[(uint8_t)(*wakeUpMode - kAPP_TypicalWakeUp)]);
             break;
         case kAPP_PowerModeDeepSleep:
-            PRINTF("\t%s\n\r\n", g_DeepSleepWakeArray[(uint8_t)(wakeUpMode - kAPP_TypicalWakeUp)]);
+            PRINTF("\t%s\n\r\n", g_DeepSleepWakeArray[(uint8_t)(*wakeUpMode - kAPP_TypicalWakeUp)]);
             break;
         case kAPP_PowerModePowerDown:
-            PRINTF("\t%s\n\r\n", g_PowerDownWakeArray[(uint8_t)(wakeUpMode - kAPP_TypicalWakeUp)]);
+            PRINTF("\t%s\n\r\n", g_PowerDownWakeArray[(uint8_t)(*wakeUpMode - kAPP_TypicalWakeUp)]);
             break;
         case kAPP_PowerModeDeepPowerDown:
-            PRINTF("\t%s\n\r\n", g_DeepPowerDownWakeArray[(uint8_t)(wakeUpMode - kAPP_TypicalWakeUp)]);
+            PRINTF("\t%s\n\r\n", g_DeepPowerDownWakeArray[(uint8_t)(*wakeUpMode - kAPP_TypicalWakeUp)]);
             break;
         default:
             assert(false);
             break;
     }
-    return wakeUpMode;
+    return true;
 }
 
 static void APP_SetWakeUpMode(app_power_mode_t targetPowerMode, app_wakeup_mode_t targetWakeMode)
@@ -437,33 +920,35 @@ static void APP_SetWakeUpMode(app_power_mode_t targetPowerMode, app_wakeup_mode_
                 assert(false);
                 break;
         }
+        APP_TraceClockSwitch();
     }
 }
 
 static void APP_SetSleepWakeUpMode(app_wakeup_mode_t targetWakeMode)
 {
+      s_sleepStopFroHf = (targetWakeMode == kAPP_SlowWakeUp);
       switch (targetWakeMode)
       {
           case kAPP_TypicalWakeUp:
               /* the least wake up delay */
               SPC0->LPWKUP_DELAY &= ~SPC_LPWKUP_DELAY_LPWKUP_DELAY_MASK;
               SPC0->LPWKUP_DELAY |= SPC_LPWKUP_DELAY_LPWKUP_DELAY(0x00);
-              BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength, 
-                                    kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
+              APP_ReportClockSwitch(BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength, 
+                                                          kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength));
               break;
           case kAPP_FastWakeUp:
               /* the least wake up delay */
               SPC0->LPWKUP_DELAY &= ~SPC_LPWKUP_DELAY_LPWKUP_DELAY_MASK;
               SPC0->LPWKUP_DELAY |= SPC_LPWKUP_DELAY_LPWKUP_DELAY(0x00);
-              BOARD_BootClockFRO96M(kSPC_CoreLDO_NormalVoltage, kSPC_CoreLDO_NormalDriveStrength, 
-                                    kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
+              APP_StartClockFRO96M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
               break;
           case kAPP_SlowWakeUp:
               /* the least wake up delay */
               SPC0->LPWKUP_DELAY &= ~SPC_LPWKUP_DELAY_LPWKUP_DELAY_MASK;
               SPC0->LPWKUP_DELAY |= SPC_LPWKUP_DELAY_LPWKUP_DELAY(0x00);
-              BOARD_BootClockFRO12M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength, 
-                                    kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
+              /* Lowers the voltage after the switch to FRO12M, FRO_HF is stopped at Sleep entry. */
+              APP_ReportClockSwitch(BOARD_BootClockFRO12M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength, 
+                                                          kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength));
               break;
           default:
               assert(false);
@@ -479,29 +964,23 @@ static void APP_SetDeepSleepWakeUpMode(app_wakeup_mode_t targetWakeMode)
               /* the least wake up delay */
               SPC0->LPWKUP_DELAY &= ~SPC_LPWKUP_DELAY_LPWKUP_DELAY_MASK;
               SPC0->LPWKUP_DELAY |= SPC_LPWKUP_DELAY_LPWKUP_DELAY(0x00);
-              BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength, 
-                                    kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
+              APP_ReportClockSwitch(BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength, 
+                                                          kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength));
               break;
           case kAPP_FastWakeUp:
               /* the least wake up delay */
               SPC0->LPWKUP_DELAY &= ~SPC_LPWKUP_DELAY_LPWKUP_DELAY_MASK;
               SPC0->LPWKUP_DELAY |= SPC_LPWKUP_DELAY_LPWKUP_DELAY(0x00);
               /* enable FIRC and SIRC in DeepSleep mode for fast wake up */
-              SCG0->FIRCCSR &= ~SCG_FIRCCSR_LK_MASK;
-              SCG0->SIRCCSR &= ~SCG_SIRCCSR_LK_MASK;
-              SCG0->FIRCCSR |= SCG_FIRCCSR_FIRCSTEN_MASK;
-              SCG0->SIRCCSR |= SCG_SIRCCSR_SIRCSTEN_MASK;
-              SCG0->FIRCCSR |= SCG_FIRCCSR_LK_MASK;
-              SCG0->SIRCCSR |= SCG_SIRCCSR_LK_MASK;
-              BOARD_BootClockFRO96M(kSPC_CoreLDO_NormalVoltage, kSPC_CoreLDO_NormalDriveStrength, 
-                                    kSPC_CoreLDO_NormalVoltage, kSPC_CoreLDO_NormalDriveStrength);
+              CLOCK_SetLowPowerOscillators((uint32_t)kCLOCK_OscFroHf | (uint32_t)kCLOCK_OscFro12M);
+              APP_StartClockFRO96M(kSPC_CoreLDO_NormalVoltage, kSPC_CoreLDO_NormalDriveStrength);
               break;
           case kAPP_SlowWakeUp:
               /* the least wake up delay */
               SPC0->LPWKUP_DELAY &= ~SPC_LPWKUP_DELAY_LPWKUP_DELAY_MASK;
               SPC0->LPWKUP_DELAY |= SPC_LPWKUP_DELAY_LPWKUP_DELAY(0x00);
-              BOARD_BootClockFRO12M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength, 
-                                    kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
+              APP_ReportClockSwitch(BOARD_BootClockFRO12M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength, 
+                                                          kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength));
               break;
           default:
               assert(false);
@@ -514,25 +993,24 @@ static void APP_SetPowerDownWakeUpMode(app_wakeup_mode_t targetWakeMode)
       switch (targetWakeMode)
       {
           case kAPP_TypicalWakeUp:
-              /* Wake up delay for LDO recovery */
+              /* Wake up delay for LDO recovery, tuned by APP_TuneWakeUpDelay() with WKUP_TUNE_ENABLE */
               SPC0->LPWKUP_DELAY &= ~SPC_LPWKUP_DELAY_LPWKUP_DELAY_MASK;
-              SPC0->LPWKUP_DELAY |= SPC_LPWKUP_DELAY_LPWKUP_DELAY(0x5B);
-              BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength, 
-                                    kSPC_CoreLDO_UnderDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
+              SPC0->LPWKUP_DELAY |= SPC_LPWKUP_DELAY_LPWKUP_DELAY(s_powerDownWakeDelay);
+              APP_ReportClockSwitch(BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength, 
+                                                          kSPC_CoreLDO_UnderDriveVoltage, kSPC_CoreLDO_LowDriveStrength));
               break;
           case kAPP_FastWakeUp:
               /* the least wake up delay */
               SPC0->LPWKUP_DELAY &= ~SPC_LPWKUP_DELAY_LPWKUP_DELAY_MASK;
               SPC0->LPWKUP_DELAY |= SPC_LPWKUP_DELAY_LPWKUP_DELAY(0x00);
-              BOARD_BootClockFRO96M(kSPC_CoreLDO_NormalVoltage, kSPC_CoreLDO_NormalDriveStrength, 
-                                    kSPC_CoreLDO_NormalVoltage, kSPC_CoreLDO_NormalDriveStrength);
+              APP_StartClockFRO96M(kSPC_CoreLDO_NormalVoltage, kSPC_CoreLDO_NormalDriveStrength);
               break;
           case kAPP_SlowWakeUp:
               /* the longest wake up delay */
               SPC0->LPWKUP_DELAY &= ~SPC_LPWKUP_DELAY_LPWKUP_DELAY_MASK;
               SPC0->LPWKUP_DELAY |= SPC_LPWKUP_DELAY_LPWKUP_DELAY(0xFF);
-              BOARD_BootClockFRO12M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength, 
-                                    kSPC_CoreLDO_UnderDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
+              APP_ReportClockSwitch(BOARD_BootClockFRO12M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength, 
+                                                          kSPC_CoreLDO_UnderDriveVoltage, kSPC_CoreLDO_LowDriveStrength));
               break;
           default:
               assert(false);
@@ -548,8 +1026,8 @@ static void APP_SetDeepPowerDownWakeUpMode(app_wakeup_mode_t targetWakeMode)
         	/* the least wake up delay */
             SPC0->LPWKUP_DELAY &= ~SPC_LPWKUP_DELAY_LPWKUP_DELAY_MASK;
             SPC0->LPWKUP_DELAY |= SPC_LPWKUP_DELAY_LPWKUP_DELAY(0x00);
-            BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength,
-                                  kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
+            APP_ReportClockSwitch(BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength,
+                                                        kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength));
             break;
         default:
             assert(false);
@@ -582,12 +1060,78 @@ static void APP_SelectWakeupSource(void)
       wakeupButtonConfig.event = kWUU_ExternalPinInterrupt;
       wakeupButtonConfig.mode  = kWUU_ExternalPinActiveAlways;
       WUU_SetExternalWakeUpPinsConfig(APP_WUU, APP_WUU_WAKEUP_BUTTON_IDX, &wakeupButtonConfig);
+      PIN_PARK_Keep(APP_WUU_WAKEUP_BUTTON_PORT, 1UL << APP_WUU_WAKEUP_BUTTON_PIN);
       PRINTF("Entering Low power mode...\r\n");
       PRINTF("Please press %s to wakeup.(Please only press the wakeup button when this message appears, otherwise it will result in failure to wake up!)\r\n", APP_WUU_WAKEUP_BUTTON_NAME);
 }
 
+/* Lists the peripheral clocks that stay enabled in the low power mode without an owner. */
+static void APP_ReportClockGates(void)
+{
+    clock_gate_audit_t audit;
+
+    /* The debug console holds its clock until APP_DeinitDebugConsole. */
+    (void)CLOCK_GetClockGateAudit(&audit);
+    if ((audit.unowned[0] | audit.unowned[1]) != 0U)
+    {
+        PRINTF("Clock gates without reference, closed while asleep: MRCC_GLB_CC0 0x%08x, MRCC_GLB_CC1 0x%08x\r\n",
+               audit.unowned[0], audit.unowned[1]);
+    }
+}
+
+/* Starts the switch to 96MHz, APP_PowerPreSwitchHook completes it before the low power mode entry. */
+static void APP_StartClockFRO96M(spc_core_ldo_voltage_level_t lowpowerLdoVoltage,
+                                 spc_core_ldo_drive_strength_t lowpowerLdoStrength)
+{
+    status_t status;
+
+    status = BOARD_BootClockFRO96MStart(kSPC_CoreLDO_NormalVoltage, kSPC_CoreLDO_NormalDriveStrength,
+                                        lowpowerLdoVoltage, lowpowerLdoStrength, &s_clockStep);
+    if (status != kStatus_Success)
+    {
+        /* No second attempt: it would commit the same regulators, the mode is entered on the current clock. */
+        PRINTF("Fast wake up profile failed: regulator commit failed (%d), the clock stays at %u MHz.\r\n", status,
+               CLOCK_GetCoreSysClkFreq() / 1000000U);
+    }
+}
+
+/* Records the core clock after a switch, in MHz. */
+static void APP_TraceClockSwitch(void)
+{
+    TRACEPOINT(TRACEPOINT_ID(kTRACEPOINT_ClockSwitch, CLOCK_GetCoreSysClkFreq() / 1000000U));
+}
+
+/* A failed regulator commit never raises the clock, the low power mode is entered on the clock in effect. */
+static void APP_ReportClockSwitch(status_t status)
+{
+    if (status != kStatus_Success)
+    {
+        PRINTF("Clock switch: regulator commit failed (%d), the clock was not raised.\r\n", status);
+    }
+}
+
 static void APP_PowerPreSwitchHook(void)
 {
+    bool clockPending = s_clockStep.pending;
+
+    /* The voltage ramp has usually settled during the wake up source set up. */
+    if (BOARD_BootClockFRO96MComplete(&s_clockStep) != kStatus_Success)
+    {
+        (void)SPC_WaitBusyStatusFlagClear(APP_SPC);
+        if (BOARD_BootClockFRO96MComplete(&s_clockStep) != kStatus_Success)
+        {
+            /* The ramp did not settle within the SPC timeout, the voltage for 96MHz is not confirmed. */
+            PRINTF("Fast wake up profile failed: CORE LDO ramp not settled, the clock stays at %u MHz.\r\n",
+                   CLOCK_GetCoreSysClkFreq() / 1000000U);
+            s_clockStep.pending = false;
+            clockPending        = false;
+        }
+    }
+    if (clockPending)
+    {
+        APP_TraceClockSwitch();
+    }
+    s_froHfStopped = false;
     /* Wait for debug console output finished. */
     while (!(kLPUART_TransmissionCompleteFlag & LPUART_GetStatusFlags((LPUART_Type *)BOARD_DEBUG_UART_BASEADDR)))
     {
@@ -597,15 +1141,114 @@ static void APP_PowerPreSwitchHook(void)
 
 static void APP_PowerPostSwitchHook(void)
 {
-    BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength, 
-                          kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
+    uint32_t start = MSDK_GetCpuCycleCount();
+    uint32_t coreFreq;
+
+    if (s_clockVerifyOnWake)
+    {
+        /* Time the oscillator of the wake up profile back to its frequency, before the switch to 48MHz. */
+        s_wakeClockTarget   = ((SCG0->CSR & SCG_CSR_SCS_MASK) == SCG_CSR_SCS(3U)) ? kCLOCK_VERIFY_FroHfDiv :
+                                                                                     kCLOCK_VERIFY_Fro12M;
+        s_wakeClockCoreFreq = CLOCK_GetCoreSysClkFreq();
+        s_wakeClockStatus   = CLOCK_VERIFY_WaitSettled(s_wakeClockTarget, APP_CLOCK_SETTLE_TOLERANCE_PPM,
+                                                       APP_CLOCK_SETTLE_MAX_SAMPLES, start, &s_wakeClockSettle);
+        start               = MSDK_GetCpuCycleCount();
+    }
+
+    /* Raises the voltage before the switch back to FRO_HF, which restarts it if it was stopped. The
+     * restart runs on the clock in effect now, only the last few instructions run at 48MHz. */
+    coreFreq = CLOCK_GetCoreSysClkFreq();
+    /* The console is not up yet: a failed switch shows in the clock of the trace. */
+    (void)BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_NormalDriveStrength, 
+                                kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
+    if (s_froHfStopped)
+    {
+        s_froHfRestartCycles   = MSDK_GetCpuCycleCount() - start;
+        s_froHfRestartCoreFreq = coreFreq;
+    }
+    APP_TraceClockSwitch();
     APP_InitDebugConsole();
 }
 
+/*
+ * The low power Sleep profile pays off when the current saved while asleep exceeds the charge spent
+ * restarting FRO_HF: sleep time > restart time * I(Active) / (I(Sleep Typical) - I(Sleep Slow)).
+ * FRO_HF is only stopped when no clocked peripheral selects it, peripherals are not moved to FRO12M.
+ * I(Sleep Slow) was measured with FRO_HF running, so the reported sleep time is an upper bound.
+ */
+static void APP_ReportLowPowerSleepCost(void)
+{
+    uint32_t restartUs;
+
+    if (!s_froHfStopped)
+    {
+        PRINTF("FRO_HF kept running: a clocked peripheral selects it, peripherals are not moved to FRO12M.\r\n");
+        return;
+    }
+
+    restartUs = (uint32_t)COUNT_TO_USEC((uint64_t)s_froHfRestartCycles, s_froHfRestartCoreFreq);
+    PRINTF("FRO_HF stopped, no clocked peripheral selected it. Restart: %u us, low power Sleep pays off for "
+           "sleep times above %u us\r\n",
+           restartUs,
+           (uint32_t)(((uint64_t)restartUs * APP_ACTIVE_48M_CURRENT_UA) /
+                      (APP_SLEEP_TYPICAL_CURRENT_UA - APP_SLEEP_SLOW_CURRENT_UA)));
+}
+
+/* Measures FRO_HF and FRO12M against FRO16K and flags the ones off their trimmed frequency. */
+static void APP_VerifyClocks(void)
+{
+    static const clock_verify_target_t targets[] = {kCLOCK_VERIFY_FroHfDiv, kCLOCK_VERIFY_Fro12M};
+    static const char *const names[]             = {"FRO_HF", "FRO12M"};
+    clock_verify_result_t result;
+    uint32_t i;
+
+    for (i = 0U; i < ARRAY_SIZE(targets); i++)
+    {
+        if (CLOCK_VERIFY_Measure(targets[i], CLOCK_VERIFY_REF_SCALE, &result) == kStatus_Success)
+        {
+            PRINTF("%s: %u Hz, expected %u Hz (%d ppm)%s\r\n", names[i], result.measuredHz, result.expectedHz,
+                   result.errorPpm, CLOCK_VERIFY_IsDrifted(&result) ? ", trim drift" : "");
+        }
+    }
+}
+
+static void APP_ReportWakeClock(void)
+{
+    const char *name = (s_wakeClockTarget == kCLOCK_VERIFY_FroHfDiv) ? "FRO_HF" : "FRO12M";
+
+    if (s_wakeClockStatus == kStatus_Timeout)
+    {
+        PRINTF("Wake up clock check: no FRO16K reference\r\n");
+        return;
+    }
+
+    PRINTF("Wake up clock %s: %u Hz (%d ppm)", name, s_wakeClockSettle.result.measuredHz,
+           s_wakeClockSettle.result.errorPpm);
+    if (s_wakeClockStatus == kStatus_Success)
+    {
+        PRINTF(", settled %u us after wake up\r\n",
+               (uint32_t)COUNT_TO_USEC((uint64_t)s_wakeClockSettle.cycles, s_wakeClockCoreFreq));
+    }
+    else
+    {
+        PRINTF(", not settled after %u samples\r\n", s_wakeClockSettle.samples);
+    }
+    if (CLOCK_VERIFY_IsDrifted(&s_wakeClockSettle.result))
+    {
+        PRINTF("%s trim drift beyond %u ppm\r\n", name, CLOCK_VERIFY_DRIFT_LIMIT_PPM);
+    }
+}
+
 static void APP_PowerModeSwitch(app_power_mode_t targetPowerMode)
 {
     if (targetPowerMode != kAPP_PowerModeActive)
     {
+        TRACEPOINT(TRACEPOINT_ID(kTRACEPOINT_ModeEntry, targetPowerMode));
+        /* Unused pads must not float or drive anything while asleep. */
+        PIN_PARK_Park();
+        /* Peripherals nobody holds a clock reference on stop being clocked, Sleep keeps the bus clocks. */
+        (void)CLOCK_GetClockGateAudit(&s_lowPowerGates);
+        CLOCK_GateUnownedClocks(&s_lowPowerGates);
         switch (targetPowerMode)
         {
             case kAPP_PowerModeSleep:
@@ -624,6 +1267,9 @@ static void APP_PowerModeSwitch(app_power_mode_t targetPowerMode)
                 assert(false);
                 break;
         }
+        CLOCK_UngateClocks(&s_lowPowerGates);
+        PIN_PARK_Restore();
+        TRACEPOINT(TRACEPOINT_ID(kTRACEPOINT_ModeExit, targetPowerMode));
     }
 }
 
@@ -634,6 +1280,9 @@ static void APP_EnterSleepMode(void)
     config.clock_mode  = kCMC_GateNoneClock;
     config.main_domain = kCMC_ActiveOrSleepMode;
 
+    /* The debug console is off by now, the main clock runs from FRO12M in the Slow profile. */
+    s_froHfStopped = s_sleepStopFroHf && (CLOCK_StopFROHFClocking() == kStatus_Success);
+
     CMC_EnterLowPowerMode(APP_CMC, &config);
 }
 
@@ -644,14 +1293,12 @@ static void APP_EnterDeepSleepMode(void)
     config.clock_mode  = kCMC_GateAllSystemClocksEnterLowPowerMode;
     config.main_domain = kCMC_DeepSleepMode;
 
+    /* Besides the ones of the wake up profile, keep the oscillators that peripherals still clocked depend on. */
+    CLOCK_SetLowPowerOscillators(CLOCK_GetLowPowerOscillators() | CLOCK_GetRequiredOscillators(false));
+
     CMC_EnterLowPowerMode(APP_CMC, &config);
     
-    SCG0->FIRCCSR &= ~SCG_FIRCCSR_LK_MASK;
-    SCG0->SIRCCSR &= ~SCG_SIRCCSR_LK_MASK;
-    SCG0->FIRCCSR &= ~SCG_FIRCCSR_FIRCSTEN_MASK;
-    SCG0->SIRCCSR &= ~SCG_SIRCCSR_SIRCSTEN_MASK;
-    SCG0->FIRCCSR |= SCG_FIRCCSR_LK_MASK;
-    SCG0->SIRCCSR |= SCG_SIRCCSR_LK_MASK;
+    CLOCK_SetLowPowerOscillators(0U);
 }
 
 static void APP_EnterPowerDownMode(void)
@@ -673,3 +1320,302 @@ static void APP_EnterDeepPowerDownMode(void)
 
     CMC_EnterLowPowerMode(APP_CMC, &config);
 }
+
+#if (defined(WKUP_TUNE_ENABLE) && (WKUP_TUNE_ENABLE > 0U))
+/*
+ * Uses the PowerDown wake up delay saved in the flash parameter page, or tunes it when the board has none
+ * or a search was stopped by a reset: a delay too short for the LDO to recover can reset the device
+ * instead of waking it. The search enters PowerDown a few hundred times under a watchdog and resets the
+ * device when done.
+ */
+static void APP_TuneWakeUpDelay(void)
+{
+    wkup_tune_params_t params;
+    status_t status;
+
+    if ((WKUP_TUNE_GetParams(&params) != kStatus_Success) || WKUP_TUNE_IsSearchPending())
+    {
+        PRINTF("Tuning PowerDown wake up delay...\r\n");
+        /* The wake timer needs no pin, the wakeup button may be parked. */
+        PIN_PARK_Release(APP_WUU_WAKEUP_BUTTON_PORT, 1UL << APP_WUU_WAKEUP_BUTTON_PIN);
+        APP_WkupTuneWatchdogStart();
+        status = WKUP_TUNE_Run(APP_WkupTuneTrial, NULL, APP_WKUP_TUNE_MAX_DELAY);
+        if (status != kStatus_Success)
+        {
+            PRINTF("Wake up delay tuning failed (%d)\r\n", status);
+        }
+        /* The watchdog cannot be stopped, boot again with the saved result. */
+        PRINTF("Wake up delay tuning done, resetting.\r\n");
+        while (!(kLPUART_TransmissionCompleteFlag & LPUART_GetStatusFlags((LPUART_Type *)BOARD_DEBUG_UART_BASEADDR)))
+        {
+        }
+        NVIC_SystemReset();
+    }
+
+    if (WKUP_TUNE_GetParams(&params) != kStatus_Success)
+    {
+        PRINTF("PowerDown wake up delay: 0x%02x, not tuned\r\n", s_powerDownWakeDelay);
+        return;
+    }
+
+    /* The longest delay when no delay passed. */
+    s_powerDownWakeDelay = params.delay;
+    if (params.minPassing == WKUP_TUNE_NO_PASS)
+    {
+        PRINTF("PowerDown wake up delay: 0x%02x, no delay passed\r\n", params.delay);
+    }
+    else
+    {
+        PRINTF("PowerDown wake up delay: 0x%02x (shortest good 0x%02x + %u, %u wake ups each)\r\n", params.delay,
+               params.minPassing, params.margin, params.cycles);
+    }
+}
+
+/* Resets a hung trial, the search then resumes with that delay failed. It runs until the next reset. */
+static void APP_WkupTuneWatchdogStart(void)
+{
+    CLOCK_SetClockDiv(kCLOCK_DivWWDT0, 1U);
+    CLOCK_RequestClock(kCLOCK_GateWWDT0);
+    /* The counter runs at a quarter of the WWDT clock, 0xFF is the shortest timeout. */
+    WWDT0->TC  = WWDT_TC_COUNT(MAX((uint32_t)USEC_TO_COUNT(APP_WKUP_TUNE_WATCHDOG_MS * 1000U,
+                                                           CLOCK_GetWwdtClkFreq() / 4U), 0xFFU));
+    WWDT0->MOD = WWDT_MOD_WDEN_MASK | WWDT_MOD_WDRESET_MASK;
+    APP_WkupTuneWatchdogFeed();
+}
+
+static void APP_WkupTuneWatchdogFeed(void)
+{
+    /* The two writes of the feed sequence must not be split. */
+    uint32_t primask = DisableGlobalIRQ();
+
+    WWDT0->FEED = 0xAAU;
+    WWDT0->FEED = 0x55U;
+    EnableGlobalIRQ(primask);
+}
+
+/*
+ * One PowerDown Typical wake up from the wake timer. The core LVD is enabled in Active mode over the
+ * wake up, its flag shows a core supply still below the threshold when the wake up delay ends.
+ */
+static status_t APP_WkupTuneTrial(uint16_t delay, void *userData)
+{
+    uint8_t flags;
+
+    APP_WkupTuneWatchdogFeed();
+    /* The trial is judged by the core LVD flag, it fails without the detector. */
+    if (SPC_EnableActiveModeCoreLowVoltageDetect(APP_SPC, true) != kStatus_Success)
+    {
+        return kStatus_Fail;
+    }
+
+    s_powerDownWakeDelay = delay;
+    APP_SetWakeUpMode(kAPP_PowerModePowerDown, kAPP_TypicalWakeUp);
+    WUU_SetInternalWakeUpModulesConfig(APP_WUU, APP_WUU_WAKEUP_WAKETIMER_IDX, kWUU_InternalModuleInterrupt);
+    SPC_SetExternalVoltageDomainsConfig(APP_SPC, APP_SPC_ISO_VALUE, 0x0U);
+    SPC_ClearVoltageDetectStatusFlag(APP_SPC, (uint8_t)kSPC_CoreVDDLowVoltageDetectFlag);
+    APP_PowerPreSwitchHook();
+    WAKETIMER_StartTimer(APP_WAKETIMER, APP_WKUP_TUNE_DWELL_MS);
+
+    APP_PowerModeSwitch(kAPP_PowerModePowerDown);
+
+    /* Before the regulator changes of the clock switch back. */
+    flags = SPC_GetVoltageDetectStatusFlag(APP_SPC);
+    (void)SPC_EnableActiveModeCoreLowVoltageDetect(APP_SPC, false);
+    SPC_ClearVoltageDetectStatusFlag(APP_SPC, (uint8_t)kSPC_CoreVDDLowVoltageDetectFlag);
+    APP_PowerPostSwitchHook();
+    WAKETIMER_HaltTimer(APP_WAKETIMER);
+    WUU_ClearInternalWakeUpModulesConfig(APP_WUU, APP_WUU_WAKEUP_WAKETIMER_IDX, kWUU_InternalModuleInterrupt);
+    s_powerDownWakeDelay = APP_POWER_DOWN_WAKE_DELAY;
+
+    return ((flags & (uint8_t)kSPC_CoreVDDLowVoltageDetectFlag) != 0U) ? kStatus_Fail : kStatus_Success;
+}
+#endif /* WKUP_TUNE_ENABLE */
+
+/* Feeds a byte to the host frame receiver, until kCTRL_CmdExit. Nothing else is printed meanwhile. */
+static void APP_HostControlInput(uint8_t ch)
+{
+    ctrl_frame_t request;
+    uint8_t error[1];
+    bool running = true;
+    status_t status;
+
+    status = CTRL_ReceiverPut(&s_hostReceiver, ch, &request);
+    if (status == kStatus_NoData)
+    {
+        return;
+    }
+
+    if (status != kStatus_Success)
+    {
+        /* The sequence number of a broken frame is unknown. */
+        error[0] = (status == kStatus_Fail) ? kCTRL_StatusBadCrc : kCTRL_StatusBadFrame;
+        APP_HostSendFrame(s_hostResponse,
+                          CTRL_EncodeFrame(0U, kCTRL_ResponseError, error, sizeof(error), s_hostResponse));
+        s_hostResponseLength = 0U;
+        return;
+    }
+
+    /* Retry of the last request, its response was lost: don't run it twice. */
+    if ((s_hostResponseLength == 0U) || (request.seq != s_hostResponseSeq))
+    {
+        running           = APP_HostExecute(&request, s_hostResponse, &s_hostResponseLength);
+        s_hostResponseSeq = request.seq;
+    }
+    APP_HostSendFrame(s_hostResponse, s_hostResponseLength);
+
+    if (!running)
+    {
+        APP_FinishMenu();
+    }
+}
+
+static bool APP_HostExecute(const ctrl_frame_t *request, uint8_t *response, uint32_t *responseLength)
+{
+    uint8_t payload[CTRL_MAX_PAYLOAD];
+    uint32_t length = 1U;
+    uint32_t freq;
+    ctrl_cycle_request_t cycleRequest;
+    ctrl_cycle_telemetry_t telemetry;
+    bool running = true;
+
+    switch (request->type)
+    {
+        case kCTRL_CmdPing:
+            freq       = CLOCK_GetFreq(kCLOCK_CoreSysClk);
+            payload[0] = kCTRL_StatusOk;
+            payload[1] = CTRL_PROTOCOL_VERSION;
+            payload[2] = (uint8_t)freq;
+            payload[3] = (uint8_t)(freq >> 8U);
+            payload[4] = (uint8_t)(freq >> 16U);
+            payload[5] = (uint8_t)(freq >> 24U);
+            length     = 6U;
+            break;
+        case kCTRL_CmdRunCycles:
+            if (CTRL_ParseCycleRequest(request, &cycleRequest) != kStatus_Success)
+            {
+                payload[0] = kCTRL_StatusInvalidParam;
+                break;
+            }
+            payload[0] = APP_HostRunCycles(&cycleRequest, &telemetry);
+            if (payload[0] == kCTRL_StatusOk)
+            {
+                CTRL_SerializeTelemetry(&telemetry, &payload[1]);
+                length += CTRL_CYCLE_TELEMETRY_SIZE;
+            }
+            break;
+        case kCTRL_CmdExit:
+            payload[0] = kCTRL_StatusOk;
+            running    = false;
+            break;
+        default:
+            payload[0] = kCTRL_StatusUnknown;
+            break;
+    }
+
+    *responseLength =
+        CTRL_EncodeFrame(request->seq, (uint8_t)(request->type | kCTRL_ResponseFlag), payload, length, response);
+
+    return running;
+}
+
+/*
+ * Runs the same path as the console menu, with the wake timer instead of the wakeup button.
+ * DeepPowerDown wakes up through a reset and can't report, it is refused.
+ */
+static uint8_t APP_HostRunCycles(const ctrl_cycle_request_t *request, ctrl_cycle_telemetry_t *telemetry)
+{
+    app_power_mode_t targetPowerMode = (app_power_mode_t)request->powerMode;
+    app_wakeup_mode_t targetWakeMode = (app_wakeup_mode_t)request->wakeMode;
+    uint32_t start;
+    uint32_t elapsed;
+    uint32_t sleepStart;
+
+    if ((targetPowerMode < kAPP_PowerModeSleep) || (targetPowerMode > kAPP_PowerModePowerDown) ||
+        (targetWakeMode < kAPP_TypicalWakeUp) || (targetWakeMode > kAPP_SlowWakeUp) || (request->dwellMs == 0U) ||
+        (request->dwellMs > APP_HOST_MAX_DWELL_MS) || (request->repeat == 0U))
+    {
+        return kCTRL_StatusInvalidParam;
+    }
+
+    /* The wake timer needs no pin, the wakeup button may be parked. */
+    PIN_PARK_Release(APP_WUU_WAKEUP_BUTTON_PORT, 1UL << APP_WUU_WAKEUP_BUTTON_PIN);
+
+    (void)memset(telemetry, 0, sizeof(*telemetry));
+    telemetry->sleepMsMin      = UINT32_MAX;
+    telemetry->resumeCyclesMin = UINT32_MAX;
+    MSDK_EnableCpuCycleCounter();
+
+    while (telemetry->completed < request->repeat)
+    {
+        start = MSDK_GetCpuCycleCount();
+
+        APP_SetWakeUpMode(targetPowerMode, targetWakeMode);
+        if (targetPowerMode == kAPP_PowerModePowerDown)
+        {
+            WUU_SetInternalWakeUpModulesConfig(APP_WUU, APP_WUU_WAKEUP_WAKETIMER_IDX, kWUU_InternalModuleInterrupt);
+        }
+        if (targetPowerMode > kAPP_PowerModeSleep)
+        {
+            SPC_SetExternalVoltageDomainsConfig(APP_SPC, APP_SPC_ISO_VALUE, 0x0U);
+        }
+        APP_PowerPreSwitchHook();
+        /* The Fast wake up profile reaches its clock in APP_PowerPreSwitchHook. */
+        if (telemetry->completed == 0U)
+        {
+            telemetry->coreClock = CLOCK_GetFreq(kCLOCK_CoreSysClk);
+        }
+        WAKETIMER_StartTimer(APP_WAKETIMER, request->dwellMs);
+        sleepStart = APP_GetTicks();
+
+        elapsed = MSDK_GetCpuCycleCount() - start;
+        if (elapsed > telemetry->entryCyclesMax)
+        {
+            telemetry->entryCyclesMax = elapsed;
+        }
+
+        APP_PowerModeSwitch(targetPowerMode);
+
+        start   = MSDK_GetCpuCycleCount();
+        elapsed = APP_GetTicks() - sleepStart;
+        APP_PowerPostSwitchHook();
+        WAKETIMER_HaltTimer(APP_WAKETIMER);
+        if (targetPowerMode == kAPP_PowerModePowerDown)
+        {
+            WUU_ClearInternalWakeUpModulesConfig(APP_WUU, APP_WUU_WAKEUP_WAKETIMER_IDX, kWUU_InternalModuleInterrupt);
+        }
+
+        telemetry->sleepMsTotal += elapsed;
+        if (elapsed < telemetry->sleepMsMin)
+        {
+            telemetry->sleepMsMin = elapsed;
+        }
+        if (elapsed > telemetry->sleepMsMax)
+        {
+            telemetry->sleepMsMax = elapsed;
+        }
+
+        elapsed = MSDK_GetCpuCycleCount() - start;
+        if (elapsed < telemetry->resumeCyclesMin)
+        {
+            telemetry->resumeCyclesMin = elapsed;
+        }
+        if (elapsed > telemetry->resumeCyclesMax)
+        {
+            telemetry->resumeCyclesMax = elapsed;
+        }
+
+        telemetry->completed++;
+    }
+
+    return kCTRL_StatusOk;
+}
+
+static void APP_HostSendFrame(const uint8_t *frame, uint32_t length)
+{
+    uint32_t i;
+
+    for (i = 0U; i < length; i++)
+    {
+        (void)PUTCHAR((int)frame[i]);
+    }
+}
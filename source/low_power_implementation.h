@@ -9,6 +9,7 @@
 #define _POWER_MODE_SWITCH_
 
 #include "fsl_common.h"
+#include "event_queue.h"
 
 /*******************************************************************************
  * Definitions
@@ -32,4 +33,25 @@ typedef enum _app_wakeup_mode
     kAPP_SlowWakeUp         
 } app_wakeup_mode_t;
 
+/* Capacity of the ISR to main context event queue, must be a power of two. */
+#define APP_EVENT_QUEUE_CAPACITY (16U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* Events posted by ISRs, consumed by the main context. */
+extern event_queue_t g_appEventQueue;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+/*
+ * Scheduler idle hook. Arms the wake timer for the next timed task and puts the
+ * core into Sleep, or DeepSleep for long idle periods, when no event is pending
+ * in g_appEventQueue. The empty check and the WFI run with interrupts masked, so
+ * an ISR that posts right before the WFI leaves its interrupt pending and the
+ * WFI returns at once.
+ */
+void APP_IdleHook(uint32_t ticksToWakeUp);
+
 #endif /*_POWER_MODE_SWITCH_*/
@@ -0,0 +1,151 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "lp_delay.h"
+#include "fsl_clock.h"
+#include "fsl_cmc.h"
+#include "fsl_reset.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* OSTIMER counts CLK_1M, one count per microsecond. */
+#define LP_DELAY_TIMER OSTIMER0
+#define LP_DELAY_IRQn  OS_EVENT_IRQn
+
+/* The OSTIMER counter is 42 bits wide, Gray coded. */
+#define LP_DELAY_COUNTER_MASK ((1ULL << 42U) - 1ULL)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+#if (defined(LP_DELAY_ENABLE) && (LP_DELAY_ENABLE > 0U))
+static uint64_t LP_DELAY_GetCount(void);
+static void LP_DELAY_SetMatch(uint64_t count);
+#endif /* LP_DELAY_ENABLE */
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static lp_delay_statistics_t s_lpDelayStatistics;
+
+#if (defined(LP_DELAY_ENABLE) && (LP_DELAY_ENABLE > 0U))
+static bool s_lpDelayTimerReady;
+#endif /* LP_DELAY_ENABLE */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+#if (defined(LP_DELAY_ENABLE) && (LP_DELAY_ENABLE > 0U))
+/* Binary value of the counter. */
+static uint64_t LP_DELAY_GetCount(void)
+{
+    uint64_t count;
+    uint32_t shift;
+
+    /* Reading the low word latches the high word. */
+    count = LP_DELAY_TIMER->EVTIMERL;
+    count |= ((uint64_t)LP_DELAY_TIMER->EVTIMERH) << 32U;
+
+    for (shift = 1U; shift < 64U; shift <<= 1U)
+    {
+        count ^= count >> shift;
+    }
+
+    return count;
+}
+
+/* Arms the match interrupt at a binary count, returns once the match register is updated. */
+static void LP_DELAY_SetMatch(uint64_t count)
+{
+    uint64_t gray = count ^ (count >> 1U);
+
+    while ((LP_DELAY_TIMER->OSEVENT_CTRL & OSTIMER_OSEVENT_CTRL_MATCH_WR_RDY_MASK) != 0U)
+    {
+    }
+
+    /* Clear the flag of the previous delay, then enable the interrupt. */
+    LP_DELAY_TIMER->OSEVENT_CTRL |= OSTIMER_OSEVENT_CTRL_OSTIMER_INTRFLAG_MASK;
+    LP_DELAY_TIMER->MATCH_L = (uint32_t)gray;
+    LP_DELAY_TIMER->MATCH_H = (uint32_t)(gray >> 32U);
+    LP_DELAY_TIMER->OSEVENT_CTRL |= OSTIMER_OSEVENT_CTRL_OSTIMER_INTENA_MASK;
+
+    while ((LP_DELAY_TIMER->OSEVENT_CTRL & OSTIMER_OSEVENT_CTRL_MATCH_WR_RDY_MASK) != 0U)
+    {
+    }
+}
+
+/* Only wakes the core, the delay loop checks the counter. */
+void OS_EVENT_IRQHandler(void)
+{
+    /* Writing 0 to the flag leaves it set. */
+    LP_DELAY_TIMER->OSEVENT_CTRL &=
+        ~(OSTIMER_OSEVENT_CTRL_OSTIMER_INTRFLAG_MASK | OSTIMER_OSEVENT_CTRL_OSTIMER_INTENA_MASK);
+    SDK_ISR_EXIT_BARRIER;
+}
+
+uint32_t SDK_DelaySleep(uint32_t delayTime_us)
+{
+    uint32_t primask;
+    uint64_t start;
+
+    if ((__get_IPSR() != 0U) || (__get_BASEPRI() != 0U) || (CLOCK_GetFreq(kCLOCK_Clk1M) == 0U))
+    {
+        s_lpDelayStatistics.spinCount++;
+        return delayTime_us;
+    }
+
+    /* Selected for the delay only: an OSTIMER clock source counts as a user of FRO12M in DeepSleep. */
+    CLOCK_RequestClock(kCLOCK_GateOSTIMER0);
+    CLOCK_AttachClk(kCLK_1M_to_OSTIMER);
+    if (!s_lpDelayTimerReady)
+    {
+        RESET_ClearPeripheralReset(kOSTIMER0_RST_SHIFT_RSTn);
+        NVIC_ClearPendingIRQ(LP_DELAY_IRQn);
+        (void)EnableIRQ(LP_DELAY_IRQn);
+        s_lpDelayTimerReady = true;
+    }
+
+    s_lpDelayStatistics.sleepCount++;
+    s_lpDelayStatistics.sleepUs += delayTime_us;
+
+    primask = DisableGlobalIRQ();
+    /* Sleep: only the core clock is gated. */
+    CMC_SetClockMode(CMC, kCMC_GateNoneClock);
+    CMC_SetMAINPowerMode(CMC, kCMC_ActiveOrSleepMode);
+    /* Read back the last register to ensure all writes have completed. */
+    (void)CMC->PMCTRL[0];
+    SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+
+    start = LP_DELAY_GetCount();
+    LP_DELAY_SetMatch((start + delayTime_us) & LP_DELAY_COUNTER_MASK);
+
+    /* A match written after the counter passed it never fires, the counter check covers that case. */
+    while (((LP_DELAY_GetCount() - start) & LP_DELAY_COUNTER_MASK) < delayTime_us)
+    {
+        __DSB();
+        __WFI();
+        /* Serve whatever woke the core, the delay is only a minimum. */
+        EnableGlobalIRQ(primask);
+        primask = DisableGlobalIRQ();
+    }
+
+    LP_DELAY_TIMER->OSEVENT_CTRL &= ~OSTIMER_OSEVENT_CTRL_OSTIMER_INTENA_MASK;
+    NVIC_ClearPendingIRQ(LP_DELAY_IRQn);
+    EnableGlobalIRQ(primask);
+
+    CLOCK_AttachClk(kNONE_to_OSTIMER);
+    CLOCK_ReleaseClock(kCLOCK_GateOSTIMER0);
+
+    return 0U;
+}
+#endif /* LP_DELAY_ENABLE */
+
+const lp_delay_statistics_t *LP_DELAY_GetStatistics(void)
+{
+    return &s_lpDelayStatistics;
+}
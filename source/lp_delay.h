@@ -0,0 +1,76 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _LP_DELAY_H_
+#define _LP_DELAY_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup lp_delay
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Spend SDK_DelayAtLeastUs() delays in Sleep, woken by OSTIMER0 (1 - enable, 0 - disable).
+ *
+ * The module then owns OSTIMER0 and defines OS_EVENT_IRQHandler(). Disabled, delays spin with the weak
+ * SDK default.
+ */
+#ifndef LP_DELAY_ENABLE
+#define LP_DELAY_ENABLE (1U)
+#endif
+
+/*! @brief Delay statistics. */
+typedef struct _lp_delay_statistics
+{
+    uint32_t sleepCount; /*!< Delays spent in Sleep. */
+    uint32_t sleepUs;    /*!< Total time of the delays spent in Sleep, in microseconds. */
+    uint32_t spinCount;  /*!< Delays left to spin: in an ISR, or with BASEPRI set. */
+} lp_delay_statistics_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Waits a delay in Sleep, woken by an OSTIMER0 match on CLK_1M. Overrides the weak SDK default when
+ * LP_DELAY_ENABLE is set.
+ *
+ * SDK_DelayAtLeastUs() only calls it for delays of at least SDK_DELAY_SLEEP_MIN_US.
+ *
+ * Sleep only gates the core clock, so the peripherals the caller is waiting on keep running. DeepSleep
+ * is left to the scheduler idle hook, its bus clock gating is not safe in the middle of a driver sequence.
+ * Interrupts are served during the delay. In an ISR, or with BASEPRI set, the OSTIMER interrupt could not
+ * wake the core and the whole delay is left to spin.
+ *
+ * @param delayTime_us Delay time in microseconds.
+ * @return Part of the delay left to spin, in microseconds.
+ */
+uint32_t SDK_DelaySleep(uint32_t delayTime_us);
+
+/*!
+ * @brief Gets the delay statistics.
+ *
+ * @return Pointer to the statistics.
+ */
+const lp_delay_statistics_t *LP_DELAY_GetStatistics(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _LP_DELAY_H_ */
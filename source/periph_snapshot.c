@@ -0,0 +1,81 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "periph_snapshot.h"
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+void SNAPSHOT_Init(snapshot_t *snapshot,
+                   const snapshot_region_t *regions,
+                   uint32_t regionCount,
+                   uint32_t *storage,
+                   uint32_t storageWords)
+{
+    uint32_t words = 0U;
+    uint32_t i;
+
+    assert((snapshot != NULL) && (regions != NULL) && (storage != NULL));
+
+    for (i = 0U; i < regionCount; i++)
+    {
+        words += regions[i].words;
+    }
+    assert(words <= storageWords);
+    (void)words;
+    (void)storageWords;
+
+    snapshot->regions     = regions;
+    snapshot->regionCount = regionCount;
+    snapshot->storage     = storage;
+    snapshot->valid       = false;
+}
+
+void SNAPSHOT_Save(snapshot_t *snapshot)
+{
+    const snapshot_region_t *region = snapshot->regions;
+    const snapshot_region_t *end    = &snapshot->regions[snapshot->regionCount];
+    uint32_t *dst                   = snapshot->storage;
+    const volatile uint32_t *src;
+    uint32_t words;
+
+    for (; region != end; region++)
+    {
+        src = (const volatile uint32_t *)region->address;
+        for (words = region->words; words != 0U; words--)
+        {
+            *dst++ = *src++;
+        }
+    }
+
+    snapshot->valid = true;
+}
+
+status_t SNAPSHOT_Restore(const snapshot_t *snapshot)
+{
+    const snapshot_region_t *region = snapshot->regions;
+    const snapshot_region_t *end    = &snapshot->regions[snapshot->regionCount];
+    const uint32_t *src             = snapshot->storage;
+    volatile uint32_t *dst;
+    uint32_t words;
+
+    if (!snapshot->valid)
+    {
+        return kStatus_NoData;
+    }
+
+    for (; region != end; region++)
+    {
+        dst = (volatile uint32_t *)region->restoreAddress;
+        for (words = region->words; words != 0U; words--)
+        {
+            *dst++ = *src++;
+        }
+    }
+
+    return kStatus_Success;
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _PERIPH_SNAPSHOT_H_
+#define _PERIPH_SNAPSHOT_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup periph_snapshot
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @brief Describes consecutive registers of a peripheral.
+ *
+ * @param base Peripheral base address, for example PORT0_BASE.
+ * @param type Peripheral register layout, for example PORT_Type.
+ * @param member First register, for example PCR[2].
+ * @param words Number of consecutive 32-bit registers.
+ */
+#define SNAPSHOT_REGION(base, type, member, words) SNAPSHOT_REGION_ALIAS(base, type, member, member, words)
+
+/*!
+ * @brief Describes registers that are restored through other registers, for example the SET alias of
+ * a clock gate register, so that a restore only turns on what was on and never turns anything off.
+ */
+#define SNAPSHOT_REGION_ALIAS(base, type, member, alias, words)               \
+    {                                                                         \
+        (uint32_t)(base) + (uint32_t)offsetof(type, member),                  \
+        (uint32_t)(base) + (uint32_t)offsetof(type, alias), (uint32_t)(words) \
+    }
+
+/*! @brief Registers saved and restored together, see SNAPSHOT_REGION(). */
+typedef struct _snapshot_region
+{
+    uint32_t address;        /*!< Address of the first register to save. */
+    uint32_t restoreAddress; /*!< Address of the first register to restore. */
+    uint32_t words;          /*!< Number of consecutive registers. */
+} snapshot_region_t;
+
+/*!
+ * @brief Register snapshot.
+ *
+ * Regions are saved and restored in table order, so a table lists clock gates first, then
+ * configuration registers, then the registers that enable the peripheral. Only peripherals with
+ * their clock enabled can be saved.
+ */
+typedef struct _snapshot
+{
+    const snapshot_region_t *regions; /*!< Region table. */
+    uint32_t regionCount;             /*!< Number of regions. */
+    uint32_t *storage;                /*!< Saved values, in retained RAM. */
+    bool valid;                       /*!< storage holds a snapshot. */
+} snapshot_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes a snapshot.
+ *
+ * @param snapshot Snapshot handle.
+ * @param regions Region table.
+ * @param regionCount Number of regions.
+ * @param storage Storage for the saved values, one word per register of the table.
+ * @param storageWords Size of the storage in words.
+ */
+void SNAPSHOT_Init(snapshot_t *snapshot,
+                   const snapshot_region_t *regions,
+                   uint32_t regionCount,
+                   uint32_t *storage,
+                   uint32_t storageWords);
+
+/*!
+ * @brief Saves the registers.
+ *
+ * @param snapshot Snapshot handle.
+ */
+void SNAPSHOT_Save(snapshot_t *snapshot);
+
+/*!
+ * @brief Writes the saved values back.
+ *
+ * @param snapshot Snapshot handle.
+ * @retval kStatus_Success The registers are restored.
+ * @retval kStatus_NoData Nothing was saved, the caller has to initialize the peripherals.
+ */
+status_t SNAPSHOT_Restore(const snapshot_t *snapshot);
+
+/*!
+ * @brief Discards the saved values.
+ *
+ * @param snapshot Snapshot handle.
+ */
+static inline void SNAPSHOT_Invalidate(snapshot_t *snapshot)
+{
+    snapshot->valid = false;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _PERIPH_SNAPSHOT_H_ */
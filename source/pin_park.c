@@ -0,0 +1,216 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "pin_park.h"
+#include "fsl_port.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Pins per PORT. */
+#define PIN_PARK_PORT_PINS (32U)
+
+/* Index of the lowest set bit. */
+#define PIN_PARK_LOWEST_PIN(mask) (31U - (uint32_t)__CLZ((mask) & (0U - (mask))))
+
+/* Manager state of a port. */
+typedef struct _pin_park_state
+{
+    uint32_t keep;                       /* Pins kept by PIN_PARK_Keep(). */
+    uint32_t parked;                     /* Pins parked by the last PIN_PARK_Park(). */
+    uint32_t lowGroupCount;              /* Leading entries of groups written to GPCLR, the others go to GPCHR. */
+    uint32_t groupCount;                 /* Entries in groups. */
+    uint32_t groups[PIN_PARK_PORT_PINS]; /* Global pin control words restoring the parked pins. */
+} pin_park_state_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static pin_park_state_t *PIN_PARK_GetState(PORT_Type *base);
+static void PIN_PARK_BuildGroups(pin_park_state_t *state, const uint16_t *pcr);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const pin_park_port_t *s_pinParkPorts;
+static uint32_t s_pinParkPortCount;
+static pin_park_state_t s_pinParkState[PIN_PARK_MAX_PORTS];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static pin_park_state_t *PIN_PARK_GetState(PORT_Type *base)
+{
+    uint32_t i;
+
+    for (i = 0U; i < s_pinParkPortCount; i++)
+    {
+        if (s_pinParkPorts[i].base == base)
+        {
+            return &s_pinParkState[i];
+        }
+    }
+
+    assert(false);
+    return NULL;
+}
+
+/*
+ * Groups the parked pins by saved PCR value, each group is one GPCLR or GPCHR word. Pins are
+ * taken lowest first, so the GPCLR groups come first.
+ */
+static void PIN_PARK_BuildGroups(pin_park_state_t *state, const uint16_t *pcr)
+{
+    uint32_t remaining = state->parked;
+    uint32_t pin;
+    uint32_t other;
+    uint32_t half;
+    uint32_t mask;
+    uint32_t candidates;
+
+    state->groupCount    = 0U;
+    state->lowGroupCount = 0U;
+    while (remaining != 0U)
+    {
+        pin  = PIN_PARK_LOWEST_PIN(remaining);
+        half = pin & 0x10U;
+
+        /* Pins of the same half with the same value. */
+        mask       = 0U;
+        candidates = remaining & (0xFFFFUL << half);
+        while (candidates != 0U)
+        {
+            other = PIN_PARK_LOWEST_PIN(candidates);
+            if (pcr[other] == pcr[pin])
+            {
+                mask |= 1UL << other;
+            }
+            candidates &= candidates - 1U;
+        }
+        remaining &= ~mask;
+
+        /* The write enable bits of GPCLR are pins 0-15, the ones of GPCHR pins 16-31. */
+        state->groups[state->groupCount++] = ((mask >> half) << 16U) | pcr[pin];
+        if (half == 0U)
+        {
+            state->lowGroupCount = state->groupCount;
+        }
+    }
+}
+
+void PIN_PARK_Init(const pin_park_port_t *ports, uint32_t count)
+{
+    uint32_t i;
+
+    assert((ports != NULL) && (count <= PIN_PARK_MAX_PORTS));
+
+    s_pinParkPorts     = ports;
+    s_pinParkPortCount = count;
+    for (i = 0U; i < count; i++)
+    {
+        s_pinParkState[i].keep          = 0U;
+        s_pinParkState[i].parked        = 0U;
+        s_pinParkState[i].lowGroupCount = 0U;
+        s_pinParkState[i].groupCount    = 0U;
+    }
+}
+
+void PIN_PARK_Keep(PORT_Type *base, uint32_t mask)
+{
+    PIN_PARK_GetState(base)->keep |= mask;
+}
+
+void PIN_PARK_Release(PORT_Type *base, uint32_t mask)
+{
+    PIN_PARK_GetState(base)->keep &= ~mask;
+}
+
+void PIN_PARK_Park(void)
+{
+    const pin_park_port_t *port;
+    pin_park_state_t *state;
+    uint16_t pcr[PIN_PARK_PORT_PINS];
+    uint32_t candidates;
+    uint32_t pin;
+    uint32_t i;
+
+    for (i = 0U; i < s_pinParkPortCount; i++)
+    {
+        port          = &s_pinParkPorts[i];
+        state         = &s_pinParkState[i];
+        state->parked = 0U;
+
+        /* Gated again afterwards if the port is otherwise unused. */
+        CLOCK_RequestClock(port->clock);
+
+        /* Missing pins read as zero, the parked value, and are skipped like parked ones. */
+        candidates = ~(port->keep | state->keep);
+        while (candidates != 0U)
+        {
+            pin      = PIN_PARK_LOWEST_PIN(candidates);
+            pcr[pin] = (uint16_t)port->base->PCR[pin];
+            if ((pcr[pin] != PIN_PARK_PCR) && (0U == (pcr[pin] & PORT_PCR_LK_MASK)))
+            {
+                state->parked |= 1UL << pin;
+            }
+            candidates &= candidates - 1U;
+        }
+
+        if (state->parked != 0U)
+        {
+            PIN_PARK_BuildGroups(state, pcr);
+            if (0U != (state->parked & 0xFFFFU))
+            {
+                port->base->GPCLR = ((state->parked & 0xFFFFU) << 16U) | PIN_PARK_PCR;
+            }
+            if (0U != (state->parked >> 16U))
+            {
+                port->base->GPCHR = (state->parked & 0xFFFF0000U) | PIN_PARK_PCR;
+            }
+        }
+
+        CLOCK_ReleaseClock(port->clock);
+    }
+}
+
+void PIN_PARK_Restore(void)
+{
+    const pin_park_port_t *port;
+    pin_park_state_t *state;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0U; i < s_pinParkPortCount; i++)
+    {
+        port  = &s_pinParkPorts[i];
+        state = &s_pinParkState[i];
+        if (state->parked == 0U)
+        {
+            continue;
+        }
+
+        /* Gated again afterwards if the port is otherwise unused. */
+        CLOCK_RequestClock(port->clock);
+
+        for (j = 0U; j < state->lowGroupCount; j++)
+        {
+            port->base->GPCLR = state->groups[j];
+        }
+        for (; j < state->groupCount; j++)
+        {
+            port->base->GPCHR = state->groups[j];
+        }
+        state->parked = 0U;
+
+        CLOCK_ReleaseClock(port->clock);
+    }
+}
+
+uint32_t PIN_PARK_GetParkedPins(PORT_Type *base)
+{
+    return PIN_PARK_GetState(base)->parked;
+}
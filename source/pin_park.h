@@ -0,0 +1,101 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _PIN_PARK_H_
+#define _PIN_PARK_H_
+
+#include "fsl_common.h"
+#include "fsl_clock.h"
+
+/*!
+ * @addtogroup pin_park
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Number of ports the manager can handle. */
+#ifndef PIN_PARK_MAX_PORTS
+#define PIN_PARK_MAX_PORTS (4U)
+#endif
+
+/*! @brief PCR value of a parked pin: pin function disabled, no pull resistor, input buffer off. */
+#define PIN_PARK_PCR (0x0000U)
+
+/*! @brief Port handled by the manager. */
+typedef struct _pin_park_port
+{
+    PORT_Type *base;       /*!< PORT peripheral base pointer. */
+    clock_ip_name_t clock; /*!< PORT clock gate, turned on while the PCRs are accessed. */
+    uint32_t keep;         /*!< Pins never parked, for example debug and reset pins. */
+} pin_park_port_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes the pin parking manager.
+ *
+ * @param ports Ports to handle, the table must stay valid.
+ * @param count Number of ports, up to PIN_PARK_MAX_PORTS.
+ */
+void PIN_PARK_Init(const pin_park_port_t *ports, uint32_t count);
+
+/*!
+ * @brief Excludes pins from parking, for pins used by an active wake up source or a peripheral
+ * that keeps running in low power modes.
+ *
+ * @param base PORT peripheral base pointer, one of the ports passed to PIN_PARK_Init().
+ * @param mask Pins, bit n for pin n.
+ */
+void PIN_PARK_Keep(PORT_Type *base, uint32_t mask);
+
+/*!
+ * @brief Allows pins excluded with PIN_PARK_Keep() to be parked again.
+ *
+ * @param base PORT peripheral base pointer.
+ * @param mask Pins, bit n for pin n.
+ */
+void PIN_PARK_Release(PORT_Type *base, uint32_t mask);
+
+/*!
+ * @brief Parks every configured pin that is not kept. Called right before entering a low power mode.
+ *
+ * The current PCR values are saved, then all pins of a port are parked with at most one GPCLR
+ * and one GPCHR write. Pins already parked, and locked pins, are left alone.
+ */
+void PIN_PARK_Park(void);
+
+/*!
+ * @brief Restores the pins parked by PIN_PARK_Park(). Called right after wake up.
+ *
+ * Pins that had the same PCR value are restored together, one GPCLR or GPCHR write per distinct value.
+ */
+void PIN_PARK_Restore(void);
+
+/*!
+ * @brief Gets the pins of a port parked by the last PIN_PARK_Park().
+ *
+ * @param base PORT peripheral base pointer.
+ * @return Parked pins, bit n for pin n.
+ */
+uint32_t PIN_PARK_GetParkedPins(PORT_Type *base);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _PIN_PARK_H_ */
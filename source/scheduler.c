@@ -0,0 +1,265 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scheduler.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Task control block from its queue pool index. */
+#define SCHED_TASK_FROM_INDEX(index) (s_taskTable[(index)])
+
+/* True if tick a is at or after tick b, handles counter wrap. */
+#define SCHED_TICK_REACHED(a, b) ((int32_t)((a) - (b)) >= 0)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void SCHED_MakeReady(sched_task_t *task);
+static void SCHED_InsertTimer(sched_task_t *task);
+static void SCHED_DrainEvents(void);
+static void SCHED_ExpireTimers(uint32_t now);
+static sched_task_t *SCHED_GetHighestReady(void);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const sched_config_t *s_schedConfig;
+/* Both queues index the same task slots: a task ID is allocated in both pools at creation. */
+POOL_LIST_DEFINE(schedReady, SCHED_MAX_TASKS);
+POOL_LIST_DEFINE(schedTimer, SCHED_MAX_TASKS);
+static pool_list_label_t s_readyQueue; /* Ordered by priority, FIFO within a priority. */
+static pool_list_label_t s_timerQueue; /* Ordered by deadline, FIFO within a deadline. */
+static sched_task_t *s_taskTable[SCHED_MAX_TASKS];
+#if (defined(SCHED_ENABLE_STATISTICS) && (SCHED_ENABLE_STATISTICS > 0U))
+static sched_statistics_t s_schedStatistics;
+#endif
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void SCHED_MakeReady(sched_task_t *task)
+{
+    pool_list_index_t index = POOL_LIST_GetHead(&s_readyQueue);
+
+    while (index != POOL_LIST_INVALID_INDEX)
+    {
+        if (SCHED_TASK_FROM_INDEX(index)->priority > task->priority)
+        {
+            (void)POOL_LIST_AddPrevElement(&s_readyQueue, index, task->id);
+            return;
+        }
+        index = POOL_LIST_GetNext(&s_readyQueue, index);
+    }
+
+    (void)POOL_LIST_AddTail(&s_readyQueue, task->id);
+}
+
+/* Keeps the timer queue ordered by deadline, equal deadlines in FIFO order. */
+static void SCHED_InsertTimer(sched_task_t *task)
+{
+    pool_list_index_t index = POOL_LIST_GetHead(&s_timerQueue);
+
+    while (index != POOL_LIST_INVALID_INDEX)
+    {
+        if (!SCHED_TICK_REACHED(task->deadline, SCHED_TASK_FROM_INDEX(index)->deadline))
+        {
+            (void)POOL_LIST_AddPrevElement(&s_timerQueue, index, task->id);
+            return;
+        }
+        index = POOL_LIST_GetNext(&s_timerQueue, index);
+    }
+
+    (void)POOL_LIST_AddTail(&s_timerQueue, task->id);
+}
+
+static void SCHED_DrainEvents(void)
+{
+    uint32_t id;
+
+    if (s_schedConfig->eventQueue == NULL)
+    {
+        return;
+    }
+
+    while (EVENT_QUEUE_Get(s_schedConfig->eventQueue, &id) == kStatus_Success)
+    {
+        if ((id < SCHED_MAX_TASKS) && POOL_LIST_IsAllocated(&s_timerQueue, (pool_list_index_t)id))
+        {
+            SCHED_Activate(s_taskTable[id]);
+        }
+    }
+}
+
+static void SCHED_ExpireTimers(uint32_t now)
+{
+    pool_list_index_t index = POOL_LIST_GetHead(&s_timerQueue);
+
+    while ((index != POOL_LIST_INVALID_INDEX) && SCHED_TICK_REACHED(now, SCHED_TASK_FROM_INDEX(index)->deadline))
+    {
+        (void)POOL_LIST_RemoveHead(&s_timerQueue);
+        SCHED_MakeReady(SCHED_TASK_FROM_INDEX(index));
+        index = POOL_LIST_GetHead(&s_timerQueue);
+    }
+}
+
+static sched_task_t *SCHED_GetHighestReady(void)
+{
+    pool_list_index_t index = POOL_LIST_RemoveHead(&s_readyQueue);
+
+    return (index == POOL_LIST_INVALID_INDEX) ? NULL : SCHED_TASK_FROM_INDEX(index);
+}
+
+void SCHED_Init(const sched_config_t *config)
+{
+    assert((config != NULL) && (config->getTicks != NULL) && (config->idle != NULL));
+
+    s_schedConfig = config;
+    POOL_LIST_Init(&s_readyQueue, POOL_LIST_NODES(schedReady), POOL_LIST_BITMAP(schedReady),
+                   POOL_LIST_ALLOCATED(schedReady), (uint16_t)SCHED_MAX_TASKS);
+    POOL_LIST_Init(&s_timerQueue, POOL_LIST_NODES(schedTimer), POOL_LIST_BITMAP(schedTimer),
+                   POOL_LIST_ALLOCATED(schedTimer), (uint16_t)SCHED_MAX_TASKS);
+
+#if (defined(SCHED_ENABLE_STATISTICS) && (SCHED_ENABLE_STATISTICS > 0U))
+    (void)memset(&s_schedStatistics, 0, sizeof(s_schedStatistics));
+    MSDK_EnableCpuCycleCounter();
+#endif
+}
+
+status_t SCHED_CreateTask(sched_task_t *task, sched_task_handler_t handler, void *param, uint8_t priority)
+{
+    pool_list_index_t index;
+
+    assert((task != NULL) && (handler != NULL));
+
+    if (priority >= SCHED_PRIORITY_COUNT)
+    {
+        return kStatus_OutOfRange;
+    }
+
+    /* Slots are never freed, so both pools hand out the same index. */
+    index = POOL_LIST_Alloc(&s_timerQueue);
+    if (index == POOL_LIST_INVALID_INDEX)
+    {
+        return kStatus_OutOfRange;
+    }
+    if (POOL_LIST_Alloc(&s_readyQueue) != index)
+    {
+        assert(false);
+        return kStatus_Fail;
+    }
+
+    task->handler  = handler;
+    task->param    = param;
+    task->deadline = 0U;
+    task->period   = 0U;
+    task->priority = priority;
+    task->id       = (uint8_t)index;
+
+    s_taskTable[index] = task;
+
+    return kStatus_Success;
+}
+
+void SCHED_Activate(sched_task_t *task)
+{
+    if (POOL_LIST_IsMember(&s_readyQueue, task->id))
+    {
+        return;
+    }
+    (void)POOL_LIST_RemoveElement(&s_timerQueue, task->id);
+    SCHED_MakeReady(task);
+}
+
+status_t SCHED_ActivateFromISR(const sched_task_t *task)
+{
+    assert(s_schedConfig->eventQueue != NULL);
+
+    return EVENT_QUEUE_Post(s_schedConfig->eventQueue, task->id);
+}
+
+void SCHED_ActivateAfter(sched_task_t *task, uint32_t delay, uint32_t period)
+{
+    SCHED_Cancel(task);
+
+    task->deadline = s_schedConfig->getTicks() + delay;
+    task->period   = period;
+    SCHED_InsertTimer(task);
+}
+
+void SCHED_Cancel(sched_task_t *task)
+{
+    (void)POOL_LIST_RemoveElement(&s_readyQueue, task->id);
+    (void)POOL_LIST_RemoveElement(&s_timerQueue, task->id);
+    task->period = 0U;
+}
+
+void SCHED_RunOnce(void)
+{
+    sched_task_t *task;
+    pool_list_index_t index;
+    uint32_t now;
+#if (defined(SCHED_ENABLE_STATISTICS) && (SCHED_ENABLE_STATISTICS > 0U))
+    uint32_t cycles = MSDK_GetCpuCycleCount();
+#endif
+
+    SCHED_DrainEvents();
+    now = s_schedConfig->getTicks();
+    SCHED_ExpireTimers(now);
+
+    task = SCHED_GetHighestReady();
+    if (task == NULL)
+    {
+        index = POOL_LIST_GetHead(&s_timerQueue);
+#if (defined(SCHED_ENABLE_STATISTICS) && (SCHED_ENABLE_STATISTICS > 0U))
+        s_schedStatistics.idleCount++;
+#endif
+        s_schedConfig->idle((index == POOL_LIST_INVALID_INDEX) ? SCHED_NO_DEADLINE :
+                                                                 (SCHED_TASK_FROM_INDEX(index)->deadline - now));
+        return;
+    }
+
+#if (defined(SCHED_ENABLE_STATISTICS) && (SCHED_ENABLE_STATISTICS > 0U))
+    cycles = MSDK_GetCpuCycleCount() - cycles;
+    s_schedStatistics.dispatchCount++;
+    s_schedStatistics.lastDispatchCycles = cycles;
+    if (cycles > s_schedStatistics.maxDispatchCycles)
+    {
+        s_schedStatistics.maxDispatchCycles = cycles;
+    }
+#endif
+
+    task->handler(task->param);
+
+    /* Reload a periodic task unless the handler re-queued or cancelled it. */
+    if ((task->period != 0U) && !POOL_LIST_IsMember(&s_readyQueue, task->id) &&
+        !POOL_LIST_IsMember(&s_timerQueue, task->id))
+    {
+        task->deadline += task->period;
+        if (SCHED_TICK_REACHED(now, task->deadline))
+        {
+            /* Overrun: skip the missed periods instead of running back to back. */
+            task->deadline = now + task->period;
+        }
+        SCHED_InsertTimer(task);
+    }
+}
+
+void SCHED_Run(void)
+{
+    for (;;)
+    {
+        SCHED_RunOnce();
+    }
+}
+
+#if (defined(SCHED_ENABLE_STATISTICS) && (SCHED_ENABLE_STATISTICS > 0U))
+const sched_statistics_t *SCHED_GetStatistics(void)
+{
+    return &s_schedStatistics;
+}
+#endif
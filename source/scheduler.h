@@ -0,0 +1,165 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+#include "fsl_common.h"
+#include "fsl_component_pool_list.h"
+#include "event_queue.h"
+
+/*!
+ * @addtogroup scheduler
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Number of task priorities, 0 is the highest. */
+#ifndef SCHED_PRIORITY_COUNT
+#define SCHED_PRIORITY_COUNT (4U)
+#endif
+
+/*! @brief Maximum number of tasks, sizes the ready and timer queue pools. */
+#ifndef SCHED_MAX_TASKS
+#define SCHED_MAX_TASKS (8U)
+#endif
+
+/*! @brief Collect dispatch overhead statistics with the DWT cycle counter (1 - enable, 0 - disable). */
+#ifndef SCHED_ENABLE_STATISTICS
+#define SCHED_ENABLE_STATISTICS (1U)
+#endif
+
+/*! @brief Value passed to the idle hook when no timed task is pending. */
+#define SCHED_NO_DEADLINE (0xFFFFFFFFU)
+
+/*! @brief Task entry, runs to completion. */
+typedef void (*sched_task_handler_t)(void *param);
+
+/*! @brief Statically allocated task control block. */
+typedef struct _sched_task
+{
+    sched_task_handler_t handler; /*!< Task entry. */
+    void *param;                  /*!< Parameter passed to the entry. */
+    uint32_t deadline;            /*!< Tick at which a timed task becomes ready. */
+    uint32_t period;              /*!< Reload period in ticks, 0 for one shot. */
+    uint8_t priority;             /*!< Task priority, 0 is the highest. */
+    uint8_t id;                   /*!< Task ID, the queue pool index, used to activate the task from an ISR. */
+} sched_task_t;
+
+/*! @brief Scheduler platform hooks. */
+typedef struct _sched_config
+{
+    uint32_t (*getTicks)(void);           /*!< Returns the free running tick counter. */
+    void (*idle)(uint32_t ticksToWakeUp); /*!< Called when no task is ready; SCHED_NO_DEADLINE if no timed task. */
+    event_queue_t *eventQueue;            /*!< Queue receiving task IDs posted from ISRs. */
+} sched_config_t;
+
+/*! @brief Dispatch statistics. */
+typedef struct _sched_statistics
+{
+    uint32_t dispatchCount;      /*!< Number of task dispatches. */
+    uint32_t lastDispatchCycles; /*!< Scheduler cycles spent before the last dispatch. */
+    uint32_t maxDispatchCycles;  /*!< Worst case scheduler cycles before a dispatch. */
+    uint32_t idleCount;          /*!< Number of idle hook calls. */
+} sched_statistics_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes the scheduler.
+ *
+ * @param config Platform hooks, must stay valid while the scheduler runs.
+ */
+void SCHED_Init(const sched_config_t *config);
+
+/*!
+ * @brief Registers a task.
+ *
+ * @param task Task control block, statically allocated by the caller.
+ * @param handler Task entry.
+ * @param param Parameter passed to the entry.
+ * @param priority Task priority, 0 is the highest.
+ * @retval kStatus_Success The task is registered, idle.
+ * @retval kStatus_OutOfRange Too many tasks or invalid priority.
+ */
+status_t SCHED_CreateTask(sched_task_t *task, sched_task_handler_t handler, void *param, uint8_t priority);
+
+/*!
+ * @brief Makes a task ready. Main context only.
+ *
+ * A task already ready stays queued once. A pending timed activation is cancelled.
+ *
+ * @param task Task handle.
+ */
+void SCHED_Activate(sched_task_t *task);
+
+/*!
+ * @brief Makes a task ready from an ISR.
+ *
+ * The task ID is posted to the scheduler event queue, the task is queued by the
+ * main context on the next scheduler pass.
+ *
+ * @param task Task handle.
+ * @retval kStatus_Success The activation is queued.
+ * @retval kStatus_OutOfRange The event queue is full.
+ */
+status_t SCHED_ActivateFromISR(const sched_task_t *task);
+
+/*!
+ * @brief Makes a task ready after a delay, optionally periodically. Main context only.
+ *
+ * @param task Task handle.
+ * @param delay Delay in ticks.
+ * @param period Reload period in ticks, 0 for one shot.
+ */
+void SCHED_ActivateAfter(sched_task_t *task, uint32_t delay, uint32_t period);
+
+/*!
+ * @brief Removes a task from the ready and timer queues. Main context only.
+ *
+ * @param task Task handle.
+ */
+void SCHED_Cancel(sched_task_t *task);
+
+/*!
+ * @brief Runs one scheduler pass.
+ *
+ * Drains ISR activations, readies expired timed tasks and dispatches the
+ * highest priority ready task. Calls the idle hook when nothing is ready.
+ */
+void SCHED_RunOnce(void);
+
+/*!
+ * @brief Runs the scheduler forever.
+ */
+void SCHED_Run(void);
+
+#if (defined(SCHED_ENABLE_STATISTICS) && (SCHED_ENABLE_STATISTICS > 0U))
+/*!
+ * @brief Gets the dispatch statistics.
+ *
+ * @return Pointer to the statistics.
+ */
+const sched_statistics_t *SCHED_GetStatistics(void);
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _SCHEDULER_H_ */
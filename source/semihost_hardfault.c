@@ -34,6 +34,12 @@
 // In most cases this will allow applications containing semihosting
 // operations to execute (to some degree) when the debugger is not connected.
 //
+// Any other hard fault is handed to CRASH_DUMP_FaultHandler(), which saves
+// the stacked registers, fault status and part of the stack into a retained
+// crash record and resets the device. The record is reported on next boot.
+// So is a fault with a stacked frame outside SRAM or a stacked PC outside
+// flash and SRAM, the handler does not read through them.
+//
 // == NOTE ==
 //
 // Correct execution of the application containing semihosted operations
@@ -60,16 +66,46 @@ void HardFault_Handler(void){
             "B  _process             \n"
             "_MSP:                   \n"
             "MRS    R0, MSP          \n"
-        // Load the instruction that triggered hard fault
+        // The stacked frame must be a word aligned block in SRAM, a
+        // corrupt stack pointer would fault again on the loads below
         "_process:                   \n"
+            "LDR    R1,=__base_SRAM  \n"
+            "CMP    R0,R1            \n"
+            "BLO    _not_semihost    \n"
+            "LDR    R1,=(__top_SRAM - 32) \n"
+            "CMP    R0,R1            \n"
+            "BHI    _not_semihost    \n"
+            "TST    R0,#3            \n"
+            "BNE    _not_semihost    \n"
+        // The stacked PC must be a halfword aligned flash or SRAM address
             "LDR    R1,[R0,#24]      \n"
+            "TST    R1,#1            \n"
+            "BNE    _not_semihost    \n"
+            "LDR    R2,=__base_PROGRAM_FLASH \n"
+            "CMP    R1,R2            \n"
+            "BLO    _check_sram_pc   \n"
+            "LDR    R2,=(__top_PROGRAM_FLASH - 2) \n"
+            "CMP    R1,R2            \n"
+            "BLS    _load_instr      \n"
+            "_check_sram_pc:         \n"
+            "LDR    R2,=__base_SRAM  \n"
+            "CMP    R1,R2            \n"
+            "BLO    _not_semihost    \n"
+            "LDR    R2,=(__top_SRAM - 2) \n"
+            "CMP    R1,R2            \n"
+            "BHI    _not_semihost    \n"
+        // Load the instruction that triggered hard fault
+            "_load_instr:            \n"
             "LDRH   R2,[r1]          \n"
         // Semihosting instruction is "BKPT 0xAB" (0xBEAB)
             "LDR    R3,=0xBEAB       \n"
             "CMP    R2,R3            \n"
             "BEQ    _semihost_return \n"
-        // Wasn't semihosting instruction so enter infinite loop
-            "B .                     \n"
+        // Wasn't semihosting instruction so record the fault and
+        // reset, CRASH_DUMP_FaultHandler(frame, EXC_RETURN) does not return
+            "_not_semihost:          \n"
+            "MOV    R1, LR           \n"
+            "B      CRASH_DUMP_FaultHandler \n"
         // Was semihosting instruction, so adjust location to
         // return to by 1 instruction (2 bytes), then exit function
             "_semihost_return:       \n"
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "tracepoint.h"
+#include "fsl_debug_console.h"
+
+#if (defined(TRACEPOINT_ENABLE) && (TRACEPOINT_ENABLE > 0U))
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+__attribute__((section(TRACEPOINT_SECTION))) tracepoint_buffer_t g_tracepointBuffer;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+uint32_t TRACEPOINT_Init(void)
+{
+    uint32_t count = 0U;
+
+    if (g_tracepointBuffer.magic == TRACEPOINT_MAGIC)
+    {
+        count = (g_tracepointBuffer.index < TRACEPOINT_BUFFER_SIZE) ? g_tracepointBuffer.index : TRACEPOINT_BUFFER_SIZE;
+    }
+    else
+    {
+        TRACEPOINT_Clear();
+    }
+
+    MSDK_EnableCpuCycleCounter();
+
+    return count;
+}
+
+void TRACEPOINT_Clear(void)
+{
+    uint32_t primask = DisableGlobalIRQ();
+
+    (void)memset(g_tracepointBuffer.records, 0, sizeof(g_tracepointBuffer.records));
+    g_tracepointBuffer.index = 0U;
+    g_tracepointBuffer.magic = TRACEPOINT_MAGIC;
+    EnableGlobalIRQ(primask);
+}
+
+void TRACEPOINT_Dump(void)
+{
+    uint32_t end = g_tracepointBuffer.index;
+    uint32_t seq = (end > TRACEPOINT_BUFFER_SIZE) ? (end - TRACEPOINT_BUFFER_SIZE) : 0U;
+    uint32_t previous = g_tracepointBuffer.records[seq & (TRACEPOINT_BUFFER_SIZE - 1U)].timestamp;
+    tracepoint_record_t record;
+
+    PRINTF("\r\n    seq  event    arg       cycles        delta\r\n");
+    for (; seq != end; seq++)
+    {
+        /* Copy first, a tracepoint may overwrite the slot while printing. */
+        record = g_tracepointBuffer.records[seq & (TRACEPOINT_BUFFER_SIZE - 1U)];
+        PRINTF("%7u  0x%04x  0x%04x  %10u  %10u\r\n", seq, TRACEPOINT_EVENT(record.id), TRACEPOINT_ARG(record.id),
+               record.timestamp, record.timestamp - previous);
+        previous = record.timestamp;
+    }
+}
+#else
+uint32_t TRACEPOINT_Init(void)
+{
+    return 0U;
+}
+
+void TRACEPOINT_Clear(void)
+{
+}
+
+void TRACEPOINT_Dump(void)
+{
+}
+#endif /* TRACEPOINT_ENABLE */
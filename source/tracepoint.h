@@ -0,0 +1,147 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _TRACEPOINT_H_
+#define _TRACEPOINT_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup tracepoint
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Enable the tracepoints (1 - enable, 0 - disable). */
+#ifndef TRACEPOINT_ENABLE
+#define TRACEPOINT_ENABLE (1U)
+#endif
+
+/*! @brief Number of records kept, must be a power of two. */
+#ifndef TRACEPOINT_BUFFER_SIZE
+#define TRACEPOINT_BUFFER_SIZE (64U)
+#endif
+
+/*!
+ * @brief Section holding the trace buffer.
+ *
+ * The buffer must not be cleared by the startup code so that it survives warm
+ * resets, and must sit in SRAM retained in Power Down.
+ */
+#ifndef TRACEPOINT_SECTION
+#define TRACEPOINT_SECTION ".noinit"
+#endif
+
+/*! @brief Marks a valid trace buffer. */
+#define TRACEPOINT_MAGIC (0x54524345U) /* 'TRCE' */
+
+/*! @brief Builds a 32-bit tracepoint ID from a 16-bit event and a 16-bit argument. */
+#define TRACEPOINT_ID(event, arg) ((((uint32_t)(event)) << 16U) | (((uint32_t)(arg)) & 0xFFFFU))
+
+/*! @brief Gets the event part of a tracepoint ID. */
+#define TRACEPOINT_EVENT(id) ((uint32_t)(id) >> 16U)
+
+/*! @brief Gets the argument part of a tracepoint ID. */
+#define TRACEPOINT_ARG(id) ((uint32_t)(id)&0xFFFFU)
+
+/*! @brief Tracepoint events. */
+enum _tracepoint_event
+{
+    kTRACEPOINT_Boot           = 1U, /*!< Boot, argument is the low half of the CMC SRS register. */
+    kTRACEPOINT_ModeEntry      = 2U, /*!< Low power mode entry, argument is the app_power_mode_t. */
+    kTRACEPOINT_ModeExit       = 3U, /*!< Back from a low power mode, argument is the app_power_mode_t. */
+    kTRACEPOINT_ClockSwitch    = 4U, /*!< Core clock switch, argument is the new frequency in MHz. */
+    kTRACEPOINT_ConsoleInit    = 5U, /*!< Debug console re-initialized. */
+    kTRACEPOINT_ConsoleDeinit  = 6U, /*!< Debug console torn down. */
+    kTRACEPOINT_Idle           = 7U, /*!< Scheduler idle, argument is the ticks to the next timed task. */
+    kTRACEPOINT_UserEventStart = 0x100U, /*!< First event ID free for application use. */
+};
+
+/*! @brief One trace record. */
+typedef struct _tracepoint_record
+{
+    uint32_t id;        /*!< Tracepoint ID, see TRACEPOINT_ID(). */
+    uint32_t timestamp; /*!< DWT cycle count, does not advance while the core clock is gated. */
+} tracepoint_record_t;
+
+/*! @brief Retained trace buffer. */
+typedef struct _tracepoint_buffer
+{
+    uint32_t magic;                                      /*!< TRACEPOINT_MAGIC when the content is valid. */
+    uint32_t index;                                      /*!< Number of records written, wraps. */
+    tracepoint_record_t records[TRACEPOINT_BUFFER_SIZE]; /*!< Ring of records, oldest overwritten first. */
+} tracepoint_buffer_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+#if (defined(TRACEPOINT_ENABLE) && (TRACEPOINT_ENABLE > 0U))
+/* Trace buffer, not initialized by the startup code. */
+extern tracepoint_buffer_t g_tracepointBuffer;
+#endif
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes the trace buffer and the cycle counter.
+ *
+ * A valid buffer left by the previous run is kept, new records are appended to it.
+ *
+ * @return Number of records kept from the previous run.
+ */
+uint32_t TRACEPOINT_Init(void);
+
+/*!
+ * @brief Clears the trace buffer.
+ */
+void TRACEPOINT_Clear(void);
+
+/*!
+ * @brief Prints the trace buffer on the debug console, oldest record first.
+ *
+ * Each line holds the record sequence number, event, argument, cycle count and
+ * the cycle delta to the previous record.
+ */
+void TRACEPOINT_Dump(void);
+
+/*!
+ * @brief Records a tracepoint. Safe to call from any context.
+ *
+ * @param id Tracepoint ID, see TRACEPOINT_ID().
+ */
+static inline void TRACEPOINT(uint32_t id)
+{
+#if (defined(TRACEPOINT_ENABLE) && (TRACEPOINT_ENABLE > 0U))
+    uint32_t primask = DisableGlobalIRQ();
+    uint32_t index   = g_tracepointBuffer.index;
+    tracepoint_record_t *record = &g_tracepointBuffer.records[index & (TRACEPOINT_BUFFER_SIZE - 1U)];
+
+    record->id               = id;
+    record->timestamp        = DWT->CYCCNT;
+    g_tracepointBuffer.index = index + 1U;
+    EnableGlobalIRQ(primask);
+#else
+    (void)id;
+#endif
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _TRACEPOINT_H_ */
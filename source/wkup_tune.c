@@ -0,0 +1,193 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "wkup_tune.h"
+#include "crc32.h"
+
+#if (defined(WKUP_TUNE_ENABLE) && (WKUP_TUNE_ENABLE > 0U))
+
+#ifndef WKUP_TUNE_PARAM_SECTION
+#error WKUP_TUNE_ENABLE needs WKUP_TUNE_PARAM_SECTION on a flash parameter page.
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Number of bytes covered by the CRCs. */
+#define WKUP_TUNE_PARAMS_CRC_LENGTH (offsetof(wkup_tune_params_t, crc))
+#define WKUP_TUNE_SEARCH_CRC_LENGTH (offsetof(wkup_tune_search_t, crc))
+
+/* Marks a search state. */
+#define WKUP_TUNE_SEARCH_MAGIC (0x53524348U) /* 'SRCH' */
+
+/* Retained search state. Delays below low failed, high passed once checked. */
+typedef struct _wkup_tune_search
+{
+    uint32_t magic;     /* WKUP_TUNE_SEARCH_MAGIC while a search runs. */
+    uint16_t maxDelay;  /* Longest delay of the search. */
+    uint16_t low;       /* Shortest delay not known to fail. */
+    uint16_t high;      /* Shortest good delay, maxDelay until it is checked. */
+    uint16_t candidate; /* Delay under test, failed if the device resets. */
+    uint16_t checked;   /* maxDelay passed. */
+    uint16_t failed;    /* maxDelay failed. */
+    uint32_t crc;       /* CRC-32 of all previous fields. */
+} wkup_tune_search_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint32_t WKUP_TUNE_PatternWord(uint32_t seed, uint32_t index);
+static bool WKUP_TUNE_CheckDelay(wkup_tune_trial_t trial, void *userData, uint16_t delay);
+static void WKUP_TUNE_Update(wkup_tune_search_t *search, bool passed);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+__attribute__((section(WKUP_TUNE_PARAM_SECTION))) static wkup_tune_params_t s_wkupTuneParams;
+__attribute__((section(WKUP_TUNE_STATE_SECTION))) static wkup_tune_search_t s_wkupTuneSearch;
+
+/* Written before each trial and read back after the wake up, retained in the tuned mode. */
+static uint32_t s_wkupTunePattern[WKUP_TUNE_PATTERN_WORDS];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* Differs for each trial and flips all bits between neighbouring words. */
+static uint32_t WKUP_TUNE_PatternWord(uint32_t seed, uint32_t index)
+{
+    uint32_t word = seed ^ (index * 0x9E3779B9U);
+
+    return ((index & 1U) != 0U) ? ~word : word;
+}
+
+static bool WKUP_TUNE_CheckDelay(wkup_tune_trial_t trial, void *userData, uint16_t delay)
+{
+    uint32_t cycle;
+    uint32_t seed;
+    uint32_t i;
+
+    for (cycle = 0U; cycle < WKUP_TUNE_CYCLES; cycle++)
+    {
+        seed = ((uint32_t)delay << 16U) | cycle;
+        for (i = 0U; i < WKUP_TUNE_PATTERN_WORDS; i++)
+        {
+            s_wkupTunePattern[i] = WKUP_TUNE_PatternWord(seed, i);
+        }
+
+        if (trial(delay, userData) != kStatus_Success)
+        {
+            return false;
+        }
+
+        /* Read back at full speed right after the wake up. */
+        for (i = 0U; i < WKUP_TUNE_PATTERN_WORDS; i++)
+        {
+            if (s_wkupTunePattern[i] != WKUP_TUNE_PatternWord(seed, i))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static void WKUP_TUNE_Update(wkup_tune_search_t *search, bool passed)
+{
+    if (search->checked == 0U)
+    {
+        search->checked = passed ? 1U : 0U;
+        search->failed  = passed ? 0U : 1U;
+    }
+    else if (passed)
+    {
+        search->high = search->candidate;
+    }
+    else
+    {
+        search->low = search->candidate + 1U;
+    }
+}
+
+status_t WKUP_TUNE_Run(wkup_tune_trial_t trial, void *userData, uint16_t maxDelay)
+{
+    wkup_tune_search_t search;
+    wkup_tune_params_t params;
+
+    assert(trial != NULL);
+
+    if (WKUP_TUNE_IsSearchPending() && (s_wkupTuneSearch.maxDelay == maxDelay))
+    {
+        /* The delay under test at the reset does not wake up reliably. */
+        search = s_wkupTuneSearch;
+        WKUP_TUNE_Update(&search, false);
+    }
+    else
+    {
+        (void)memset(&search, 0, sizeof(search));
+        search.magic    = WKUP_TUNE_SEARCH_MAGIC;
+        search.maxDelay = maxDelay;
+        search.high     = maxDelay;
+    }
+
+    while ((search.failed == 0U) && ((search.checked == 0U) || (search.low < search.high)))
+    {
+        search.candidate =
+            (search.checked != 0U) ? (uint16_t)(search.low + ((search.high - search.low) / 2U)) : search.high;
+        search.crc       = CRC32_Compute((const uint8_t *)&search, WKUP_TUNE_SEARCH_CRC_LENGTH);
+        s_wkupTuneSearch = search;
+
+        WKUP_TUNE_Update(&search, WKUP_TUNE_CheckDelay(trial, userData, search.candidate));
+    }
+    s_wkupTuneSearch.magic = 0U;
+
+    (void)memset(&params, 0, sizeof(params));
+    params.magic  = WKUP_TUNE_MAGIC;
+    params.cycles = WKUP_TUNE_CYCLES;
+    params.margin = WKUP_TUNE_MARGIN;
+    if (search.failed != 0U)
+    {
+        params.delay      = maxDelay;
+        params.minPassing = WKUP_TUNE_NO_PASS;
+    }
+    else
+    {
+        params.delay      = (uint16_t)MIN((uint32_t)search.high + WKUP_TUNE_MARGIN, (uint32_t)maxDelay);
+        params.minPassing = search.high;
+    }
+    params.crc = CRC32_Compute((const uint8_t *)&params, WKUP_TUNE_PARAMS_CRC_LENGTH);
+
+    /* A failed search is saved too, the next boot does not run it again. */
+    if (WKUP_TUNE_ProgramParams(&s_wkupTuneParams, &params) != kStatus_Success)
+    {
+        return kStatus_ReadOnly;
+    }
+
+    return (search.failed != 0U) ? kStatus_Fail : kStatus_Success;
+}
+
+bool WKUP_TUNE_IsSearchPending(void)
+{
+    return (s_wkupTuneSearch.magic == WKUP_TUNE_SEARCH_MAGIC) &&
+           (s_wkupTuneSearch.crc == CRC32_Compute((const uint8_t *)&s_wkupTuneSearch, WKUP_TUNE_SEARCH_CRC_LENGTH));
+}
+
+status_t WKUP_TUNE_GetParams(wkup_tune_params_t *params)
+{
+    assert(params != NULL);
+
+    if ((s_wkupTuneParams.magic != WKUP_TUNE_MAGIC) ||
+        (s_wkupTuneParams.crc != CRC32_Compute((const uint8_t *)&s_wkupTuneParams, WKUP_TUNE_PARAMS_CRC_LENGTH)))
+    {
+        return kStatus_NoData;
+    }
+
+    *params = s_wkupTuneParams;
+
+    return kStatus_Success;
+}
+#endif /* WKUP_TUNE_ENABLE */
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _WKUP_TUNE_H_
+#define _WKUP_TUNE_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup wkup_tune
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Build the wake up delay tuning (1 - enable, 0 - disable).
+ *
+ * A result lost at each power cycle would run the search again at each power up, so the module needs a
+ * flash parameter page: define WKUP_TUNE_PARAM_SECTION and implement WKUP_TUNE_ProgramParams(). This
+ * project has no flash driver, the tuning is disabled by default.
+ */
+#ifndef WKUP_TUNE_ENABLE
+#define WKUP_TUNE_ENABLE (0U)
+#endif
+
+/*! @brief Section of the flash parameter page holding the tuning result, required with WKUP_TUNE_ENABLE.
+ *
+ * WKUP_TUNE_ProgramParams() programs it, the page must be erased before the first search.
+ */
+
+/*! @brief Section of the search state, must not be cleared by the startup code. */
+#ifndef WKUP_TUNE_STATE_SECTION
+#define WKUP_TUNE_STATE_SECTION ".noinit"
+#endif
+
+/*! @brief Wake ups a delay must pass to be kept as good. */
+#ifndef WKUP_TUNE_CYCLES
+#define WKUP_TUNE_CYCLES (32U)
+#endif
+
+/*! @brief SPC timer clocks added to the shortest good delay. */
+#ifndef WKUP_TUNE_MARGIN
+#define WKUP_TUNE_MARGIN (8U)
+#endif
+
+/*! @brief Words of the RAM pattern checked over each wake up. */
+#ifndef WKUP_TUNE_PATTERN_WORDS
+#define WKUP_TUNE_PATTERN_WORDS (256U)
+#endif
+
+/*! @brief Marks a parameter record. */
+#define WKUP_TUNE_MAGIC (0x574B444CU) /* 'WKDL' */
+
+/*! @brief wkup_tune_params_t::minPassing when no delay passed. */
+#define WKUP_TUNE_NO_PASS (0xFFFFU)
+
+/*! @brief Tuning result. */
+typedef struct _wkup_tune_params
+{
+    uint32_t magic;      /*!< WKUP_TUNE_MAGIC when the record is valid. */
+    uint16_t delay;      /*!< LPWKUP_DELAY to use, the fallback delay when no delay passed. */
+    uint16_t minPassing; /*!< Shortest delay that passed, WKUP_TUNE_NO_PASS if none. */
+    uint16_t cycles;     /*!< Wake ups per tested delay. */
+    uint16_t margin;     /*!< Margin added to minPassing. */
+    uint32_t crc;        /*!< CRC-32 of all previous fields. */
+} wkup_tune_params_t;
+
+/*!
+ * @brief Runs one wake up with a delay.
+ *
+ * Enters the tuned low power mode with LPWKUP_DELAY set to delay, wakes up from a timer and checks
+ * the regulator recovered, e.g. no low voltage detect flag. The caller checks the RAM pattern.
+ *
+ * @param delay LPWKUP_DELAY value.
+ * @param userData Parameter given to WKUP_TUNE_Run().
+ * @retval kStatus_Success The wake up was good.
+ */
+typedef status_t (*wkup_tune_trial_t)(uint16_t delay, void *userData);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Searches the shortest LPWKUP_DELAY that wakes up reliably and saves it.
+ *
+ * Checks maxDelay first, then bisects [0, maxDelay). A delay is good when WKUP_TUNE_CYCLES trials
+ * in a row pass and a RAM pattern written before each one reads back intact. The saved delay is
+ * the shortest good one plus WKUP_TUNE_MARGIN. The search state is retained: a trial that resets
+ * the device counts as failed and the next call resumes the search. Debug console output must be
+ * finished, the trials enter low power modes.
+ *
+ * @param trial Runs one wake up.
+ * @param userData Passed to trial.
+ * @param maxDelay Longest delay, known to work on all parts.
+ * @retval kStatus_Success A delay is saved.
+ * @retval kStatus_Fail maxDelay failed, maxDelay is saved as the delay.
+ * @retval kStatus_ReadOnly The result could not be programmed.
+ */
+status_t WKUP_TUNE_Run(wkup_tune_trial_t trial, void *userData, uint16_t maxDelay);
+
+/*!
+ * @brief Checks for a search stopped by a reset, to be resumed with WKUP_TUNE_Run().
+ *
+ * @return true if a search was running at the last reset.
+ */
+bool WKUP_TUNE_IsSearchPending(void);
+
+/*!
+ * @brief Gets the saved result.
+ *
+ * @param params Copy of the record.
+ * @retval kStatus_Success The record is valid.
+ * @retval kStatus_NoData No valid record, the board was not tuned.
+ */
+status_t WKUP_TUNE_GetParams(wkup_tune_params_t *params);
+
+/*!
+ * @brief Programs the result to the flash parameter page.
+ *
+ * Implemented by the application with the flash program sequence of the board, there is no default.
+ *
+ * @param page Record in WKUP_TUNE_PARAM_SECTION.
+ * @param params Record to write.
+ * @retval kStatus_Success The record is written.
+ */
+status_t WKUP_TUNE_ProgramParams(wkup_tune_params_t *page, const wkup_tune_params_t *params);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _WKUP_TUNE_H_ */
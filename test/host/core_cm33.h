@@ -0,0 +1,221 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host build of the Cortex-M33 core header. Found before CMSIS/core_cm33.h on the include path of the
+ * host tests: it provides the compiler macros and intrinsics of cmsis_gcc.h as host code, then includes
+ * the real core header for the core register layout.
+ */
+#ifndef _HOST_CORE_CM33_H_
+#define _HOST_CORE_CM33_H_
+
+#include <stdint.h>
+
+/* cmsis_compiler.h and cmsis_gcc.h hold Arm instructions, this file replaces them. */
+#define __CMSIS_COMPILER_H
+#define __CMSIS_GCC_H
+
+/*******************************************************************************
+ * Compiler macros
+ ******************************************************************************/
+#define __ASM                   __asm
+#define __INLINE                inline
+#define __STATIC_INLINE         static inline
+#define __STATIC_FORCEINLINE    __attribute__((always_inline)) static inline
+#define __NO_RETURN             __attribute__((__noreturn__))
+#define __USED                  __attribute__((used))
+#define __WEAK                  __attribute__((weak))
+#define __PACKED                __attribute__((packed, aligned(1)))
+#define __PACKED_STRUCT         struct __attribute__((packed, aligned(1)))
+#define __PACKED_UNION          union __attribute__((packed, aligned(1)))
+#define __ALIGNED(x)            __attribute__((aligned(x)))
+#define __RESTRICT              __restrict
+#define __COMPILER_BARRIER()    __asm volatile("" ::: "memory")
+#define __UNALIGNED_UINT32(x)   (*(uint32_t *)(void *)(x))
+#define __UNALIGNED_UINT16_READ(addr)       (*(const uint16_t *)(const void *)(addr))
+#define __UNALIGNED_UINT16_WRITE(addr, val) (void)(*(uint16_t *)(void *)(addr) = (val))
+#define __UNALIGNED_UINT32_READ(addr)       (*(const uint32_t *)(const void *)(addr))
+#define __UNALIGNED_UINT32_WRITE(addr, val) (void)(*(uint32_t *)(void *)(addr) = (val))
+
+/*******************************************************************************
+ * Core state, read and set by the tests
+ ******************************************************************************/
+/* Interrupt masks of the simulated core. */
+extern volatile uint32_t g_hostPrimask;
+extern volatile uint32_t g_hostBasepri;
+/* Exception number of the simulated core, 0 in thread mode. */
+extern volatile uint32_t g_hostIpsr;
+
+/*******************************************************************************
+ * Intrinsics
+ ******************************************************************************/
+#define __NOP() __asm volatile("nop")
+#define __WFI() __asm volatile("" ::: "memory")
+#define __WFE() __asm volatile("" ::: "memory")
+#define __SEV() __asm volatile("" ::: "memory")
+#define __BKPT(value) __builtin_trap()
+
+__STATIC_FORCEINLINE void __ISB(void)
+{
+    __sync_synchronize();
+}
+
+__STATIC_FORCEINLINE void __DSB(void)
+{
+    __sync_synchronize();
+}
+
+__STATIC_FORCEINLINE void __DMB(void)
+{
+    __sync_synchronize();
+}
+
+__STATIC_FORCEINLINE uint32_t __REV(uint32_t value)
+{
+    return __builtin_bswap32(value);
+}
+
+__STATIC_FORCEINLINE uint32_t __REV16(uint32_t value)
+{
+    return ((value & 0xFF00FF00U) >> 8U) | ((value & 0x00FF00FFU) << 8U);
+}
+
+__STATIC_FORCEINLINE int16_t __REVSH(int16_t value)
+{
+    return (int16_t)__builtin_bswap16((uint16_t)value);
+}
+
+__STATIC_FORCEINLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+    op2 %= 32U;
+    return (op2 == 0U) ? op1 : ((op1 >> op2) | (op1 << (32U - op2)));
+}
+
+__STATIC_FORCEINLINE uint32_t __RBIT(uint32_t value)
+{
+    uint32_t result = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < 32U; i++)
+    {
+        result = (result << 1U) | ((value >> i) & 1U);
+    }
+    return result;
+}
+
+__STATIC_FORCEINLINE uint8_t __CLZ(uint32_t value)
+{
+    return (value == 0U) ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+/* Exclusive accesses always succeed, the tests run on one thread. */
+__STATIC_FORCEINLINE uint8_t __LDREXB(volatile uint8_t *addr)
+{
+    return *addr;
+}
+
+__STATIC_FORCEINLINE uint16_t __LDREXH(volatile uint16_t *addr)
+{
+    return *addr;
+}
+
+__STATIC_FORCEINLINE uint32_t __LDREXW(volatile uint32_t *addr)
+{
+    return *addr;
+}
+
+__STATIC_FORCEINLINE uint32_t __STREXB(uint8_t value, volatile uint8_t *addr)
+{
+    *addr = value;
+    return 0U;
+}
+
+__STATIC_FORCEINLINE uint32_t __STREXH(uint16_t value, volatile uint16_t *addr)
+{
+    *addr = value;
+    return 0U;
+}
+
+__STATIC_FORCEINLINE uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+    *addr = value;
+    return 0U;
+}
+
+__STATIC_FORCEINLINE void __CLREX(void)
+{
+}
+
+__STATIC_FORCEINLINE void __enable_irq(void)
+{
+    g_hostPrimask = 0U;
+}
+
+__STATIC_FORCEINLINE void __disable_irq(void)
+{
+    g_hostPrimask = 1U;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void)
+{
+    return g_hostPrimask;
+}
+
+__STATIC_FORCEINLINE void __set_PRIMASK(uint32_t priMask)
+{
+    g_hostPrimask = priMask;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_BASEPRI(void)
+{
+    return g_hostBasepri;
+}
+
+__STATIC_FORCEINLINE void __set_BASEPRI(uint32_t basePri)
+{
+    g_hostBasepri = basePri;
+}
+
+__STATIC_FORCEINLINE void __set_BASEPRI_MAX(uint32_t basePri)
+{
+    if ((basePri != 0U) && ((g_hostBasepri == 0U) || (basePri < g_hostBasepri)))
+    {
+        g_hostBasepri = basePri;
+    }
+}
+
+__STATIC_FORCEINLINE uint32_t __get_IPSR(void)
+{
+    return g_hostIpsr;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_CONTROL(void)
+{
+    return 0U;
+}
+
+__STATIC_FORCEINLINE void __set_CONTROL(uint32_t control)
+{
+    (void)control;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_FPSCR(void)
+{
+    return 0U;
+}
+
+__STATIC_FORCEINLINE void __set_FPSCR(uint32_t fpscr)
+{
+    (void)fpscr;
+}
+
+/*******************************************************************************
+ * Core register layout
+ ******************************************************************************/
+#include "../../CMSIS/core_cm33.h"
+
+#endif /* _HOST_CORE_CM33_H_ */
@@ -0,0 +1,20 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* Core registers read and written by the host intrinsics of core_cm33.h. */
+volatile uint32_t g_hostPrimask;
+volatile uint32_t g_hostBasepri;
+volatile uint32_t g_hostIpsr;
+
+/* Counters of unit_test.h. */
+uint32_t g_testChecks;
+uint32_t g_testFailures;
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <sys/mman.h>
+
+#include "fsl_clock.h"
+#include "unit_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Host memory standing in for the peripheral space, SCG0 to FMU0. */
+#define TEST_PERIPH_BASE (0x40000000UL)
+#define TEST_PERIPH_SIZE (0x00100000UL)
+
+#if (defined(FSL_CLOCK_FREQ_CACHE) && (FSL_CLOCK_FREQ_CACHE > 0U))
+/* A register written behind the clock driver is seen only after the cache is invalidated. */
+#define TEST_STALE(cached, current) (cached)
+#else
+#define TEST_STALE(cached, current) (current)
+#endif
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* SCG0 CSR is read only on the device, the host test plays the SCG and sets the clock source status. */
+static void TEST_SetSystemClockSource(uint32_t scs)
+{
+    *(volatile uint32_t *)&SCG0->CSR = SCG_CSR_SCS(scs);
+}
+
+/* Clock tree out of reset on FRO12M, FRO_HF at 48MHz, all dividers by 1. */
+static void TEST_ResetClockTree(void)
+{
+    SCG0->SIRCCSR                 = SCG_SIRCCSR_SIRC_CLK_PERIPH_EN_MASK;
+    SCG0->FIRCCSR                 = SCG_FIRCCSR_FIRCEN_MASK | SCG_FIRCCSR_FIRC_FCLK_PERIPH_EN_MASK;
+    SCG0->FIRCCFG                 = SCG_FIRCCFG_FREQ_SEL(1U);
+    SYSCON->AHBCLKDIV             = 0U;
+    MRCC0->MRCC_FRO_HF_DIV_CLKDIV = 0U;
+    MRCC0->MRCC_LPUART0_CLKSEL    = 0U;
+    MRCC0->MRCC_LPUART0_CLKDIV    = 0U;
+    TEST_SetSystemClockSource(2U);
+    CLOCK_InvalidateFreqCache();
+}
+
+static void TEST_CoreClock(void)
+{
+    TEST_ResetClockTree();
+
+    TEST_ASSERT(CLOCK_GetCoreSysClkFreq() == 12000000U);
+    TEST_ASSERT(CLOCK_GetFreq(kCLOCK_CoreSysClk) == 12000000U);
+    TEST_ASSERT(CLOCK_GetFreq(kCLOCK_SLOW_CLK) == 3000000U);
+
+    /* Main clock switched to FRO_HF behind the driver. */
+    TEST_SetSystemClockSource(3U);
+    TEST_ASSERT(CLOCK_GetFreq(kCLOCK_MainClk) == TEST_STALE(12000000U, 48000000U));
+    TEST_ASSERT(CLOCK_GetCoreSysClkFreq() == TEST_STALE(12000000U, 48000000U));
+    TEST_ASSERT(CLOCK_GetFreq(kCLOCK_SLOW_CLK) == TEST_STALE(3000000U, 12000000U));
+
+    CLOCK_InvalidateFreqCache();
+    TEST_ASSERT(CLOCK_GetFreq(kCLOCK_MainClk) == 48000000U);
+    TEST_ASSERT(CLOCK_GetCoreSysClkFreq() == 48000000U);
+    TEST_ASSERT(CLOCK_GetFreq(kCLOCK_SLOW_CLK) == 12000000U);
+
+    /* The AHB divider set through the driver invalidates the cache. */
+    CLOCK_SetClockDiv(kCLOCK_DivAHBCLK, 2U);
+    TEST_ASSERT(CLOCK_GetCoreSysClkFreq() == 24000000U);
+    TEST_ASSERT(CLOCK_GetFreq(kCLOCK_BusClk) == 24000000U);
+    TEST_ASSERT(CLOCK_GetFreq(kCLOCK_MainClk) == 48000000U);
+}
+
+static void TEST_FroHf(void)
+{
+    TEST_ResetClockTree();
+
+    TEST_ASSERT(CLOCK_GetFreq(kCLOCK_FroHf) == 48000000U);
+    TEST_ASSERT(CLOCK_GetFreq(kCLOCK_FroHfDiv) == 48000000U);
+
+    /* FRO_HF range changed behind the driver. */
+    SCG0->FIRCCFG = SCG_FIRCCFG_FREQ_SEL(3U);
+    TEST_ASSERT(CLOCK_GetFreq(kCLOCK_FroHf) == TEST_STALE(48000000U, 64000000U));
+
+    CLOCK_InvalidateFreqCache();
+    TEST_ASSERT(CLOCK_GetFreq(kCLOCK_FroHf) == 64000000U);
+
+    CLOCK_SetClockDiv(kCLOCK_DivFRO_HF_DIV, 4U);
+    TEST_ASSERT(CLOCK_GetFreq(kCLOCK_FroHfDiv) == 16000000U);
+    TEST_ASSERT(CLOCK_GetFreq(kCLOCK_FroHf) == 64000000U);
+}
+
+static void TEST_LpuartClock(void)
+{
+    TEST_ResetClockTree();
+
+    TEST_ASSERT(CLOCK_GetLpuartClkFreq(0U) == 12000000U);
+
+    /* Clock selection through the driver invalidates the cache. */
+    CLOCK_AttachClk(kFRO_HF_DIV_to_LPUART0);
+    TEST_ASSERT(MRCC0->MRCC_LPUART0_CLKSEL == 2U);
+    TEST_ASSERT(CLOCK_GetLpuartClkFreq(0U) == 48000000U);
+
+    CLOCK_SetClockDiv(kCLOCK_DivLPUART0, 4U);
+    TEST_ASSERT(CLOCK_GetLpuartClkFreq(0U) == 12000000U);
+
+    /* FRO_HF_DIV divider changed behind the driver. */
+    MRCC0->MRCC_FRO_HF_DIV_CLKDIV = 1U;
+    TEST_ASSERT(CLOCK_GetLpuartClkFreq(0U) == TEST_STALE(12000000U, 6000000U));
+    CLOCK_InvalidateFreqCache();
+    TEST_ASSERT(CLOCK_GetLpuartClkFreq(0U) == 6000000U);
+
+    /* A halted divider reads as no clock. */
+    CLOCK_SetClockDiv(kCLOCK_DivLPUART0, 0U);
+    TEST_ASSERT(CLOCK_GetLpuartClkFreq(0U) == 0U);
+    CLOCK_SetClockDiv(kCLOCK_DivLPUART0, 1U);
+    TEST_ASSERT(CLOCK_GetLpuartClkFreq(0U) == 24000000U);
+}
+
+int main(void)
+{
+    if (mmap((void *)TEST_PERIPH_BASE, TEST_PERIPH_SIZE, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0) != (void *)TEST_PERIPH_BASE)
+    {
+        (void)printf("cannot map the peripheral space\n");
+        return 1;
+    }
+
+    TEST_RUN(TEST_CoreClock);
+    TEST_RUN(TEST_FroHf);
+    TEST_RUN(TEST_LpuartClock);
+
+    return TEST_REPORT();
+}
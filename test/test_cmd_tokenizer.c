@@ -0,0 +1,240 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include "cmd_tokenizer.h"
+#include "unit_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_RING_SIZE  (32U)
+#define TEST_MAX_TOKENS (4U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static cmd_tokenizer_t s_tokenizer;
+static uint8_t s_ring[TEST_RING_SIZE];
+static cmd_token_t s_tokens[TEST_MAX_TOKENS];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void TEST_InitTokenizer(void)
+{
+    CMD_TokenizerInit(&s_tokenizer, s_ring, TEST_RING_SIZE, s_tokens, TEST_MAX_TOKENS);
+}
+
+/* Pushes the characters of str, returns the number of bytes stored. */
+static uint32_t TEST_Put(const char *str)
+{
+    uint32_t stored = 0U;
+
+    while (*str != '\0')
+    {
+        if (CMD_TokenizerPutFromISR(&s_tokenizer, (uint8_t)*str))
+        {
+            stored++;
+        }
+        str++;
+    }
+
+    return stored;
+}
+
+/* Tokenizes a single line with one token and returns that token. */
+static const cmd_token_t *TEST_SingleToken(const char *line)
+{
+    uint32_t count;
+
+    CMD_TokenizerReleaseLine(&s_tokenizer);
+    (void)TEST_Put(line);
+    TEST_ASSERT(CMD_TokenizerGetLine(&s_tokenizer, &count) == kStatus_Success);
+    TEST_ASSERT(count == 1U);
+
+    return &s_tokens[0];
+}
+
+static void TEST_Words(void)
+{
+    char copy[4];
+    uint32_t count;
+
+    TEST_InitTokenizer();
+
+    /* Nothing until the end of line. */
+    (void)TEST_Put("  run\tfast");
+    TEST_ASSERT(CMD_TokenizerGetLine(&s_tokenizer, &count) == kStatus_NoData);
+    TEST_ASSERT(count == 0U);
+    (void)TEST_Put("  \r\n");
+
+    TEST_ASSERT(CMD_TokenizerGetLine(&s_tokenizer, &count) == kStatus_Success);
+    TEST_ASSERT(count == 2U);
+    TEST_ASSERT(s_tokens[0].type == (uint8_t)kCMD_TokenWord);
+    TEST_ASSERT(s_tokens[0].length == 3U);
+    TEST_ASSERT(CMD_TokenEquals(&s_tokenizer, &s_tokens[0], "run"));
+    TEST_ASSERT(!CMD_TokenEquals(&s_tokenizer, &s_tokens[0], "ru"));
+    TEST_ASSERT(!CMD_TokenEquals(&s_tokenizer, &s_tokens[0], "runs"));
+    TEST_ASSERT(CMD_TokenEquals(&s_tokenizer, &s_tokens[1], "fast"));
+    TEST_ASSERT(CMD_TokenCharAt(&s_tokenizer, &s_tokens[1], 3U) == 't');
+
+    /* The copy is truncated to the destination. */
+    TEST_ASSERT(CMD_TokenCopy(&s_tokenizer, &s_tokens[1], copy, sizeof(copy)) == 3U);
+    TEST_ASSERT(strcmp(copy, "fas") == 0);
+
+    /* The line is held until it is released, the LF of CR LF is a blank line. */
+    TEST_ASSERT(CMD_TokenizerGetLine(&s_tokenizer, &count) == kStatus_Success);
+    CMD_TokenizerReleaseLine(&s_tokenizer);
+    TEST_ASSERT(CMD_TokenizerGetLine(&s_tokenizer, &count) == kStatus_NoData);
+    TEST_ASSERT(CMD_TokenizerGetPendingCount(&s_tokenizer) == 0U);
+}
+
+static void TEST_Integers(void)
+{
+    const cmd_token_t *token;
+
+    TEST_InitTokenizer();
+
+    token = TEST_SingleToken("42\n");
+    TEST_ASSERT((token->type == (uint8_t)kCMD_TokenInteger) && (token->value == 42));
+    token = TEST_SingleToken("+7\n");
+    TEST_ASSERT((token->type == (uint8_t)kCMD_TokenInteger) && (token->value == 7));
+    token = TEST_SingleToken("-2147483648\n");
+    TEST_ASSERT((token->type == (uint8_t)kCMD_TokenInteger) && (token->value == INT32_MIN));
+    token = TEST_SingleToken("2147483647\n");
+    TEST_ASSERT((token->type == (uint8_t)kCMD_TokenInteger) && (token->value == INT32_MAX));
+    token = TEST_SingleToken("0x1aF\n");
+    TEST_ASSERT((token->type == (uint8_t)kCMD_TokenInteger) && (token->value == 0x1AF));
+    token = TEST_SingleToken("0XFFFFFFFF\n");
+    TEST_ASSERT((token->type == (uint8_t)kCMD_TokenInteger) && ((uint32_t)token->value == 0xFFFFFFFFU));
+
+    /* Not integers: overflow, lone sign or prefix, signed hexadecimal, mixed text. */
+    token = TEST_SingleToken("2147483648\n");
+    TEST_ASSERT(token->type == (uint8_t)kCMD_TokenWord);
+    token = TEST_SingleToken("-2147483649\n");
+    TEST_ASSERT(token->type == (uint8_t)kCMD_TokenWord);
+    token = TEST_SingleToken("0x100000000\n");
+    TEST_ASSERT(token->type == (uint8_t)kCMD_TokenWord);
+    token = TEST_SingleToken("-\n");
+    TEST_ASSERT(token->type == (uint8_t)kCMD_TokenWord);
+    token = TEST_SingleToken("0x\n");
+    TEST_ASSERT(token->type == (uint8_t)kCMD_TokenWord);
+    token = TEST_SingleToken("-0x10\n");
+    TEST_ASSERT(token->type == (uint8_t)kCMD_TokenWord);
+    token = TEST_SingleToken("12ab\n");
+    TEST_ASSERT(token->type == (uint8_t)kCMD_TokenWord);
+    TEST_ASSERT(CMD_TokenEquals(&s_tokenizer, token, "12ab"));
+    CMD_TokenizerReleaseLine(&s_tokenizer);
+}
+
+static void TEST_TooManyTokens(void)
+{
+    uint32_t count;
+
+    TEST_InitTokenizer();
+
+    (void)TEST_Put("a b c d e f\nnext\n");
+    TEST_ASSERT(CMD_TokenizerGetLine(&s_tokenizer, &count) == kStatus_OutOfRange);
+    TEST_ASSERT(count == TEST_MAX_TOKENS);
+    TEST_ASSERT(CMD_TokenEquals(&s_tokenizer, &s_tokens[3], "d"));
+    CMD_TokenizerReleaseLine(&s_tokenizer);
+
+    TEST_ASSERT(CMD_TokenizerGetLine(&s_tokenizer, &count) == kStatus_Success);
+    TEST_ASSERT((count == 1U) && CMD_TokenEquals(&s_tokenizer, &s_tokens[0], "next"));
+    CMD_TokenizerReleaseLine(&s_tokenizer);
+}
+
+static void TEST_OverlongLine(void)
+{
+    uint32_t count;
+    uint32_t i;
+
+    TEST_InitTokenizer();
+
+    /* A full ring without an end of line drops the line, and the bytes that did not fit. */
+    for (i = 0U; i < TEST_RING_SIZE; i++)
+    {
+        TEST_ASSERT(CMD_TokenizerPutFromISR(&s_tokenizer, (uint8_t)'x'));
+    }
+    TEST_ASSERT(!CMD_TokenizerPutFromISR(&s_tokenizer, (uint8_t)'y'));
+    TEST_ASSERT(CMD_TokenizerGetDroppedCount(&s_tokenizer) == 1U);
+    TEST_ASSERT(CMD_TokenizerGetLine(&s_tokenizer, &count) == kStatus_Fail);
+    TEST_ASSERT(CMD_TokenizerGetPendingCount(&s_tokenizer) == 0U);
+
+    /* The tail of the overlong line is not taken as a new line. */
+    (void)TEST_Put("tail\nok 5\n");
+    TEST_ASSERT(CMD_TokenizerGetLine(&s_tokenizer, &count) == kStatus_Success);
+    TEST_ASSERT(count == 2U);
+    TEST_ASSERT(CMD_TokenEquals(&s_tokenizer, &s_tokens[0], "ok"));
+    TEST_ASSERT((s_tokens[1].type == (uint8_t)kCMD_TokenInteger) && (s_tokens[1].value == 5));
+    CMD_TokenizerReleaseLine(&s_tokenizer);
+}
+
+static void TEST_Wraparound(void)
+{
+    uint32_t count;
+    uint32_t i;
+
+    TEST_InitTokenizer();
+
+    /* Tokens that straddle the end of the ring read back in order. */
+    for (i = 0U; i < 10U; i++)
+    {
+        (void)TEST_Put("abcdefg 0x12\n");
+        TEST_ASSERT(CMD_TokenizerGetLine(&s_tokenizer, &count) == kStatus_Success);
+        TEST_ASSERT(count == 2U);
+        TEST_ASSERT(CMD_TokenEquals(&s_tokenizer, &s_tokens[0], "abcdefg"));
+        TEST_ASSERT((s_tokens[1].type == (uint8_t)kCMD_TokenInteger) && (s_tokens[1].value == 0x12));
+        CMD_TokenizerReleaseLine(&s_tokenizer);
+    }
+    TEST_ASSERT(CMD_TokenizerGetPendingCount(&s_tokenizer) == 0U);
+}
+
+static void TEST_BinaryData(void)
+{
+    static const uint8_t frame[] = {0x00U, 0x03U, 0x41U, 0x00U};
+    uint32_t count;
+    uint8_t data;
+    uint32_t i;
+
+    TEST_InitTokenizer();
+
+    /* The partial line in front of a NUL is dropped, the NUL and the frame are read as bytes. */
+    (void)TEST_Put("part");
+    for (i = 0U; i < sizeof(frame); i++)
+    {
+        (void)CMD_TokenizerPutFromISR(&s_tokenizer, frame[i]);
+    }
+    TEST_ASSERT(CMD_TokenizerGetLine(&s_tokenizer, &count) == kStatus_Busy);
+    TEST_ASSERT(CMD_TokenizerGetPendingCount(&s_tokenizer) == sizeof(frame));
+    for (i = 0U; i < sizeof(frame); i++)
+    {
+        TEST_ASSERT(CMD_TokenizerGetByte(&s_tokenizer, &data));
+        TEST_ASSERT(data == frame[i]);
+    }
+    TEST_ASSERT(!CMD_TokenizerGetByte(&s_tokenizer, &data));
+
+    /* Text lines follow the binary data. */
+    (void)TEST_Put("menu\n");
+    TEST_ASSERT(CMD_TokenizerGetLine(&s_tokenizer, &count) == kStatus_Success);
+    TEST_ASSERT((count == 1U) && CMD_TokenEquals(&s_tokenizer, &s_tokens[0], "menu"));
+    CMD_TokenizerReleaseLine(&s_tokenizer);
+}
+
+int main(void)
+{
+    TEST_RUN(TEST_Words);
+    TEST_RUN(TEST_Integers);
+    TEST_RUN(TEST_TooManyTokens);
+    TEST_RUN(TEST_OverlongLine);
+    TEST_RUN(TEST_Wraparound);
+    TEST_RUN(TEST_BinaryData);
+
+    return TEST_REPORT();
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_component_pool_list.h"
+#include "unit_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_POOL_SIZE (40U) /* Two bitmap words. */
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+POOL_LIST_DEFINE(testPool, TEST_POOL_SIZE);
+static pool_list_label_t s_list;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void TEST_InitPool(void)
+{
+    POOL_LIST_Init(&s_list, POOL_LIST_NODES(testPool), POOL_LIST_BITMAP(testPool), POOL_LIST_ALLOCATED(testPool),
+                   TEST_POOL_SIZE);
+}
+
+/* Checks the links of the list against the expected order, in both directions. */
+static void TEST_CheckOrder(const pool_list_index_t *order, uint32_t count)
+{
+    pool_list_index_t index = POOL_LIST_GetHead(&s_list);
+    uint32_t i;
+
+    TEST_ASSERT(POOL_LIST_GetSize(&s_list) == count);
+    for (i = 0U; i < count; i++)
+    {
+        TEST_ASSERT(index == order[i]);
+        TEST_ASSERT(POOL_LIST_IsMember(&s_list, order[i]));
+        if (index == POOL_LIST_INVALID_INDEX)
+        {
+            return;
+        }
+        TEST_ASSERT(POOL_LIST_GetPrev(&s_list, index) == ((i == 0U) ? POOL_LIST_INVALID_INDEX : order[i - 1U]));
+        index = POOL_LIST_GetNext(&s_list, index);
+    }
+    TEST_ASSERT(index == POOL_LIST_INVALID_INDEX);
+}
+
+static void TEST_InitEmpty(void)
+{
+    TEST_InitPool();
+
+    TEST_ASSERT(POOL_LIST_GetHead(&s_list) == POOL_LIST_INVALID_INDEX);
+    TEST_ASSERT(POOL_LIST_GetSize(&s_list) == 0U);
+    TEST_ASSERT(POOL_LIST_GetAvailableSize(&s_list) == TEST_POOL_SIZE);
+    TEST_ASSERT(POOL_LIST_RemoveHead(&s_list) == POOL_LIST_INVALID_INDEX);
+}
+
+static void TEST_AllocExhaustion(void)
+{
+    uint32_t seen[POOL_LIST_BITMAP_WORDS(TEST_POOL_SIZE)] = {0U};
+    pool_list_index_t index;
+    uint32_t i;
+
+    TEST_InitPool();
+
+    for (i = 0U; i < TEST_POOL_SIZE; i++)
+    {
+        index = POOL_LIST_Alloc(&s_list);
+        TEST_ASSERT(index < TEST_POOL_SIZE);
+        if (index >= TEST_POOL_SIZE)
+        {
+            return;
+        }
+        TEST_ASSERT((seen[index >> 5U] & (1UL << (index & 0x1FU))) == 0U);
+        seen[index >> 5U] |= (1UL << (index & 0x1FU));
+        TEST_ASSERT(POOL_LIST_IsAllocated(&s_list, index));
+        TEST_ASSERT(!POOL_LIST_IsMember(&s_list, index));
+    }
+    TEST_ASSERT(POOL_LIST_GetAvailableSize(&s_list) == 0U);
+    TEST_ASSERT(POOL_LIST_Alloc(&s_list) == POOL_LIST_INVALID_INDEX);
+
+    /* A freed slot is handed out again. */
+    TEST_ASSERT(POOL_LIST_Free(&s_list, 33U) == kLIST_Ok);
+    TEST_ASSERT(!POOL_LIST_IsAllocated(&s_list, 33U));
+    TEST_ASSERT(POOL_LIST_GetAvailableSize(&s_list) == 1U);
+    TEST_ASSERT(POOL_LIST_Alloc(&s_list) == 33U);
+    TEST_ASSERT(POOL_LIST_Alloc(&s_list) == POOL_LIST_INVALID_INDEX);
+}
+
+static void TEST_FreeErrors(void)
+{
+    pool_list_index_t index;
+
+    TEST_InitPool();
+
+    index = POOL_LIST_Alloc(&s_list);
+    TEST_ASSERT(POOL_LIST_AddTail(&s_list, index) == kLIST_Ok);
+
+    /* A linked element is not returned to the pool. */
+    TEST_ASSERT(POOL_LIST_Free(&s_list, index) == kLIST_DuplicateError);
+    TEST_ASSERT(POOL_LIST_IsAllocated(&s_list, index));
+
+    TEST_ASSERT(POOL_LIST_RemoveElement(&s_list, index) == kLIST_Ok);
+    TEST_ASSERT(POOL_LIST_Free(&s_list, index) == kLIST_Ok);
+
+    /* Double free, and free of a slot never allocated. */
+    TEST_ASSERT(POOL_LIST_Free(&s_list, index) == kLIST_OrphanElement);
+    TEST_ASSERT(POOL_LIST_Free(&s_list, TEST_POOL_SIZE - 1U) == kLIST_OrphanElement);
+    TEST_ASSERT(POOL_LIST_GetAvailableSize(&s_list) == TEST_POOL_SIZE);
+}
+
+static void TEST_AddErrors(void)
+{
+    pool_list_index_t a;
+    pool_list_index_t b;
+
+    TEST_InitPool();
+
+    a = POOL_LIST_Alloc(&s_list);
+    b = POOL_LIST_Alloc(&s_list);
+
+    /* Slots that were not allocated cannot be linked. */
+    TEST_ASSERT(POOL_LIST_AddTail(&s_list, 20U) == kLIST_OrphanElement);
+    TEST_ASSERT(POOL_LIST_AddHead(&s_list, 20U) == kLIST_OrphanElement);
+    TEST_ASSERT(POOL_LIST_GetSize(&s_list) == 0U);
+
+    /* An element is linked once. */
+    TEST_ASSERT(POOL_LIST_AddTail(&s_list, a) == kLIST_Ok);
+    TEST_ASSERT(POOL_LIST_AddTail(&s_list, a) == kLIST_DuplicateError);
+    TEST_ASSERT(POOL_LIST_AddHead(&s_list, a) == kLIST_DuplicateError);
+    TEST_ASSERT(POOL_LIST_GetSize(&s_list) == 1U);
+
+    /* AddPrevElement needs a linked reference and an allocated, unlinked new element. */
+    TEST_ASSERT(POOL_LIST_AddPrevElement(&s_list, b, a) == kLIST_OrphanElement);
+    TEST_ASSERT(POOL_LIST_AddPrevElement(&s_list, a, 20U) == kLIST_OrphanElement);
+    TEST_ASSERT(POOL_LIST_AddPrevElement(&s_list, a, a) == kLIST_DuplicateError);
+
+    /* Removing an element that is not linked. */
+    TEST_ASSERT(POOL_LIST_RemoveElement(&s_list, b) == kLIST_OrphanElement);
+    TEST_ASSERT(POOL_LIST_GetSize(&s_list) == 1U);
+}
+
+static void TEST_LinkOrder(void)
+{
+    pool_list_index_t e[5];
+    uint32_t i;
+
+    TEST_InitPool();
+
+    for (i = 0U; i < 5U; i++)
+    {
+        e[i] = POOL_LIST_Alloc(&s_list);
+    }
+
+    /* e1 e2, then e0 at the head, e4 at the tail, e3 before e4. */
+    TEST_ASSERT(POOL_LIST_AddTail(&s_list, e[1]) == kLIST_Ok);
+    TEST_ASSERT(POOL_LIST_AddTail(&s_list, e[2]) == kLIST_Ok);
+    TEST_ASSERT(POOL_LIST_AddHead(&s_list, e[0]) == kLIST_Ok);
+    TEST_ASSERT(POOL_LIST_AddTail(&s_list, e[4]) == kLIST_Ok);
+    TEST_ASSERT(POOL_LIST_AddPrevElement(&s_list, e[4], e[3]) == kLIST_Ok);
+    TEST_CheckOrder(e, 5U);
+
+    /* Insert before the head moves the head. */
+    TEST_ASSERT(POOL_LIST_RemoveElement(&s_list, e[0]) == kLIST_Ok);
+    TEST_ASSERT(!POOL_LIST_IsMember(&s_list, e[0]));
+    TEST_ASSERT(POOL_LIST_AddPrevElement(&s_list, e[1], e[0]) == kLIST_Ok);
+    TEST_CheckOrder(e, 5U);
+
+    /* Removal from the middle and the tail. */
+    {
+        const pool_list_index_t expected[3] = {e[0], e[1], e[3]};
+
+        TEST_ASSERT(POOL_LIST_RemoveElement(&s_list, e[2]) == kLIST_Ok);
+        TEST_ASSERT(POOL_LIST_RemoveElement(&s_list, e[4]) == kLIST_Ok);
+        TEST_CheckOrder(expected, 3U);
+
+        /* The tail is still right after a tail removal. */
+        TEST_ASSERT(POOL_LIST_AddTail(&s_list, e[4]) == kLIST_Ok);
+        TEST_ASSERT(POOL_LIST_GetNext(&s_list, e[3]) == e[4]);
+        TEST_ASSERT(POOL_LIST_RemoveElement(&s_list, e[4]) == kLIST_Ok);
+    }
+
+    /* RemoveHead drains the list in order. */
+    TEST_ASSERT(POOL_LIST_RemoveHead(&s_list) == e[0]);
+    TEST_ASSERT(POOL_LIST_RemoveHead(&s_list) == e[1]);
+    TEST_ASSERT(POOL_LIST_GetPrev(&s_list, e[3]) == POOL_LIST_INVALID_INDEX);
+    TEST_ASSERT(POOL_LIST_RemoveHead(&s_list) == e[3]);
+    TEST_ASSERT(POOL_LIST_RemoveHead(&s_list) == POOL_LIST_INVALID_INDEX);
+    TEST_ASSERT(POOL_LIST_GetSize(&s_list) == 0U);
+
+    /* The list is usable again after it ran empty. */
+    TEST_ASSERT(POOL_LIST_AddHead(&s_list, e[2]) == kLIST_Ok);
+    TEST_CheckOrder(&e[2], 1U);
+
+    /* Slots stay allocated while they move between lists. */
+    TEST_ASSERT(POOL_LIST_GetAvailableSize(&s_list) == (TEST_POOL_SIZE - 5U));
+}
+
+int main(void)
+{
+    TEST_RUN(TEST_InitEmpty);
+    TEST_RUN(TEST_AllocExhaustion);
+    TEST_RUN(TEST_FreeErrors);
+    TEST_RUN(TEST_AddErrors);
+    TEST_RUN(TEST_LinkOrder);
+
+    return TEST_REPORT();
+}
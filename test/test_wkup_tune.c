@@ -0,0 +1,229 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <setjmp.h>
+#include <string.h>
+
+#include "wkup_tune.h"
+#include "unit_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_MAX_DELAY (0xFFU)
+
+/* Simulated part: delays from threshold up wake up reliably. */
+typedef struct _test_part
+{
+    uint16_t threshold;    /* Shortest good delay. */
+    uint16_t resetDelay;   /* A trial at this delay resets the device, 0xFFFF for none. */
+    uint16_t flakyDelay;   /* Fails only the last wake up of each check, 0xFFFF for none. */
+    uint32_t trials;       /* Trials run. */
+    uint32_t checks;       /* Delays checked, a check starts at a new delay. */
+    uint16_t lastDelay;    /* Delay of the previous trial. */
+    uint32_t cycle;        /* Trials in a row at lastDelay. */
+} test_part_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static jmp_buf s_resetJump;
+
+static wkup_tune_params_t *s_page;
+static wkup_tune_params_t s_programmed;
+static uint32_t s_programCount;
+static bool s_programFails;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+status_t WKUP_TUNE_ProgramParams(wkup_tune_params_t *page, const wkup_tune_params_t *params)
+{
+    s_programCount++;
+    s_page = page;
+    if (s_programFails)
+    {
+        return kStatus_Fail;
+    }
+
+    *page        = *params;
+    s_programmed = *params;
+
+    return kStatus_Success;
+}
+
+static status_t TEST_Trial(uint16_t delay, void *userData)
+{
+    test_part_t *part = (test_part_t *)userData;
+
+    if ((part->trials == 0U) || (delay != part->lastDelay) || (part->cycle >= WKUP_TUNE_CYCLES))
+    {
+        part->checks++;
+        part->cycle = 0U;
+    }
+    part->trials++;
+    part->cycle++;
+    part->lastDelay = delay;
+
+    if (delay == part->resetDelay)
+    {
+        /* The search state survives, the stack does not. */
+        part->resetDelay = 0xFFFFU;
+        longjmp(s_resetJump, 1);
+    }
+    if ((delay == part->flakyDelay) && (part->cycle == WKUP_TUNE_CYCLES))
+    {
+        return kStatus_Fail;
+    }
+
+    return (delay >= part->threshold) ? kStatus_Success : kStatus_Fail;
+}
+
+static void TEST_InitPart(test_part_t *part, uint16_t threshold)
+{
+    (void)memset(part, 0, sizeof(*part));
+    part->threshold  = threshold;
+    part->resetDelay = 0xFFFFU;
+    part->flakyDelay = 0xFFFFU;
+
+    (void)memset(&s_programmed, 0, sizeof(s_programmed));
+    s_programCount = 0U;
+    s_programFails = false;
+}
+
+/* Checks the saved record for a search that found threshold. */
+static void TEST_CheckResult(uint16_t threshold)
+{
+    wkup_tune_params_t params;
+    uint32_t delay = (uint32_t)threshold + WKUP_TUNE_MARGIN;
+
+    TEST_ASSERT(WKUP_TUNE_GetParams(&params) == kStatus_Success);
+    TEST_ASSERT(memcmp(&params, &s_programmed, sizeof(params)) == 0);
+    TEST_ASSERT(params.minPassing == threshold);
+    TEST_ASSERT(params.delay == ((delay < TEST_MAX_DELAY) ? delay : TEST_MAX_DELAY));
+    TEST_ASSERT(params.cycles == WKUP_TUNE_CYCLES);
+    TEST_ASSERT(params.margin == WKUP_TUNE_MARGIN);
+    TEST_ASSERT(!WKUP_TUNE_IsSearchPending());
+}
+
+static void TEST_Bisection(void)
+{
+    static const uint16_t thresholds[] = {0U, 1U, 0x30U, 0x5BU, 0x80U, 0xF6U, 0xF7U, 0xFEU, TEST_MAX_DELAY};
+    test_part_t part;
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(thresholds) / sizeof(thresholds[0])); i++)
+    {
+        TEST_InitPart(&part, thresholds[i]);
+
+        TEST_ASSERT(WKUP_TUNE_Run(TEST_Trial, &part, TEST_MAX_DELAY) == kStatus_Success);
+        TEST_CheckResult(thresholds[i]);
+        TEST_ASSERT(s_programCount == 1U);
+
+        /* maxDelay, then a bisection of [0, maxDelay). */
+        TEST_ASSERT(part.checks <= 9U);
+        TEST_ASSERT(part.trials <= (part.checks * WKUP_TUNE_CYCLES));
+    }
+}
+
+static void TEST_AllCyclesMustPass(void)
+{
+    test_part_t part;
+
+    /* The shortest passing delay fails one wake up in WKUP_TUNE_CYCLES, the next one is kept. */
+    TEST_InitPart(&part, 0x40U);
+    part.flakyDelay = 0x40U;
+
+    TEST_ASSERT(WKUP_TUNE_Run(TEST_Trial, &part, TEST_MAX_DELAY) == kStatus_Success);
+    TEST_CheckResult(0x41U);
+}
+
+static void TEST_MaxDelayFails(void)
+{
+    wkup_tune_params_t params;
+    test_part_t part;
+
+    TEST_InitPart(&part, 0x100U);
+
+    TEST_ASSERT(WKUP_TUNE_Run(TEST_Trial, &part, TEST_MAX_DELAY) == kStatus_Fail);
+    TEST_ASSERT(part.checks == 1U);
+    TEST_ASSERT(WKUP_TUNE_GetParams(&params) == kStatus_Success);
+    TEST_ASSERT(params.delay == TEST_MAX_DELAY);
+    TEST_ASSERT(params.minPassing == WKUP_TUNE_NO_PASS);
+    TEST_ASSERT(!WKUP_TUNE_IsSearchPending());
+}
+
+static void TEST_ResumeAfterReset(void)
+{
+    /* Static, it must keep its value across longjmp(). */
+    static test_part_t part;
+
+    /* The first bisection step, 0x7F, resets the device although it is above the threshold. */
+    TEST_InitPart(&part, 0x20U);
+    part.resetDelay = 0x7FU;
+
+    if (setjmp(s_resetJump) == 0)
+    {
+        (void)WKUP_TUNE_Run(TEST_Trial, &part, TEST_MAX_DELAY);
+        TEST_ASSERT(false);
+    }
+    TEST_ASSERT(WKUP_TUNE_IsSearchPending());
+    TEST_ASSERT(s_programCount == 0U);
+
+    /* The next boot resumes with the delay under test counted as failed. */
+    part.checks = 0U;
+    TEST_ASSERT(WKUP_TUNE_Run(TEST_Trial, &part, TEST_MAX_DELAY) == kStatus_Success);
+    TEST_CheckResult(0x80U);
+    TEST_ASSERT(part.checks <= 8U);
+
+    /* A pending search for another maxDelay starts over. */
+    TEST_InitPart(&part, 0x20U);
+    part.resetDelay = 0x7FU;
+    if (setjmp(s_resetJump) == 0)
+    {
+        (void)WKUP_TUNE_Run(TEST_Trial, &part, TEST_MAX_DELAY);
+        TEST_ASSERT(false);
+    }
+    TEST_ASSERT(WKUP_TUNE_Run(TEST_Trial, &part, 0x7FU) == kStatus_Success);
+    TEST_CheckResult(0x20U);
+}
+
+static void TEST_ProgramFails(void)
+{
+    wkup_tune_params_t previous = s_programmed;
+    wkup_tune_params_t params;
+    test_part_t part;
+
+    TEST_InitPart(&part, 0x20U);
+    s_programFails = true;
+
+    TEST_ASSERT(WKUP_TUNE_Run(TEST_Trial, &part, TEST_MAX_DELAY) == kStatus_ReadOnly);
+    TEST_ASSERT(s_programCount == 1U);
+    TEST_ASSERT(!WKUP_TUNE_IsSearchPending());
+
+    /* The record of the previous test is kept. */
+    TEST_ASSERT(WKUP_TUNE_GetParams(&params) == kStatus_Success);
+    TEST_ASSERT(memcmp(&params, &previous, sizeof(params)) == 0);
+
+    /* A corrupted record is not valid. */
+    s_page->delay++;
+    TEST_ASSERT(WKUP_TUNE_GetParams(&params) == kStatus_NoData);
+    s_page->delay--;
+    s_page->magic = 0U;
+    TEST_ASSERT(WKUP_TUNE_GetParams(&params) == kStatus_NoData);
+}
+
+int main(void)
+{
+    TEST_RUN(TEST_Bisection);
+    TEST_RUN(TEST_AllCyclesMustPass);
+    TEST_RUN(TEST_MaxDelayFails);
+    TEST_RUN(TEST_ResumeAfterReset);
+    TEST_RUN(TEST_ProgramFails);
+
+    return TEST_REPORT();
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _UNIT_TEST_H_
+#define _UNIT_TEST_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Records a failure, with its location, when @p cond is false. */
+#define TEST_ASSERT(cond)                                                        \
+    do                                                                           \
+    {                                                                            \
+        g_testChecks++;                                                          \
+        if (!(cond))                                                             \
+        {                                                                        \
+            g_testFailures++;                                                    \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        }                                                                        \
+    } while (0)
+
+/*! @brief Runs one test case. */
+#define TEST_RUN(test)                  \
+    do                                  \
+    {                                   \
+        (void)printf("%s\n", #test);    \
+        test();                         \
+    } while (0)
+
+/*! @brief Prints the summary; the value is the exit code of the test program. */
+#define TEST_REPORT()                                                                         \
+    ((void)printf("%u checks, %u failed\n", (unsigned int)g_testChecks, (unsigned int)g_testFailures), \
+     (g_testFailures == 0U) ? 0 : 1)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* Defined in host/host_core.c. */
+extern uint32_t g_testChecks;
+extern uint32_t g_testFailures;
+
+#endif /* _UNIT_TEST_H_ */
@@ -26,11 +26,36 @@
 #define MAX_FIELD_WIDTH 99U
 #endif
 
+/*! @brief Fraction digits printed at most by %f, longer precisions are clamped. */
+#ifndef PRINTF_FLOAT_MAX_PRECISION
+#define PRINTF_FLOAT_MAX_PRECISION (16U)
+#endif /* PRINTF_FLOAT_MAX_PRECISION */
+
+/*! @brief Size of a converted number: a 32-bit binary number, or a %f number with 20 integer digits, the point
+ *  and PRINTF_FLOAT_MAX_PRECISION fraction digits, after the leading terminator. */
+#define PRINTF_NUMBER_STRING_SIZE MAX(33U, 22U + PRINTF_FLOAT_MAX_PRECISION)
+
 /*! @brief Keil: suppress ellipsis warning in va_arg usage below. */
 #if defined(__CC_ARM)
 #pragma diag_suppress 1256
 #endif /* __CC_ARM */
 
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/*! @brief Decimal digit pairs "00" to "99", used by ConvertDecimalToString(). */
+static const char s_digitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -42,6 +67,20 @@
  */
 static uint32_t ScanIgnoreWhiteSpace(const char **s);
 
+/*!
+ * @brief Converts a 32-bit number to decimal digits, least significant digit first.
+ *
+ * Two digits are produced per step from s_digitPairs, and the division by 100
+ * is a reciprocal multiplication, so no divide instruction is used.
+ *
+ * @param[in] nstrp     Where to write the digits.
+ * @param[in] value     The number to convert.
+ * @param[in] minDigits Minimum number of digits, padded with '0'.
+
+ * @return Pointer past the last written digit.
+ */
+static char *ConvertDecimalToString(char *nstrp, uint32_t value, uint32_t minDigits);
+
 /*!
  * @brief Converts a radix number to a string and return its length.
  *
@@ -56,12 +95,31 @@ static uint32_t ScanIgnoreWhiteSpace(const char **s);
 static int32_t ConvertRadixNumToString(char *numstr, void *nump, unsigned int neg, unsigned int radix, bool use_caps);
 
 #if (defined(PRINTF_FLOAT_ENABLE) && (PRINTF_FLOAT_ENABLE > 0U))
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+/*!
+ * @brief Checks the sign bit of a double without floating point arithmetic.
+ *
+ * @param[in] nump  Pointer to the number.
+
+ * @return true for negative numbers, -0.0 and negative NaN.
+ */
+static bool PrintIsNegativeFloat(const void *nump);
+#endif /* PRINTF_ADVANCED_ENABLE */
+
 /*!
  * @brief Converts a floating radix number to a string and return its length.
  *
+ * Only integer arithmetic is used: the IEEE-754 double is split into a 64-bit
+ * integer part and a 0.64 fixed-point fraction, fraction digits are produced by
+ * multiplying by 10, and the result is rounded to nearest, ties to even, on the
+ * exact binary value like the C library does. Integer parts of 2^64 and above
+ * are not supported and saturate. At most PRINTF_FLOAT_MAX_PRECISION fraction
+ * digits are converted. The sign is not converted, see
+ * PrintIsNegativeFloat().
+ *
  * @param[in] numstr            Converted string of the number.
  * @param[in] nump              Pointer to the number.
- * @param[in] radix             The radix to be converted to.
+ * @param[in] radix             The radix to be converted to, only 10 is supported.
  * @param[in] precision_width   Specify the precision width.
 
  * @return Length of the converted string.
@@ -500,137 +558,103 @@ static uint32_t ScanIgnoreWhiteSpace(const char **s)
     return count;
 }
 
+static char *ConvertDecimalToString(char *nstrp, uint32_t value, uint32_t minDigits)
+{
+    char *start = nstrp;
+    uint32_t q;
+    uint32_t r;
+
+    while (value >= 100U)
+    {
+        /* value / 100, exact for the whole 32-bit range. */
+        q        = (uint32_t)(((uint64_t)value * 0x51EB851FULL) >> 37U);
+        r        = (value - (q * 100U)) * 2U;
+        *nstrp++ = s_digitPairs[r + 1U];
+        *nstrp++ = s_digitPairs[r];
+        value    = q;
+    }
+    if (value >= 10U)
+    {
+        r        = value * 2U;
+        *nstrp++ = s_digitPairs[r + 1U];
+        *nstrp++ = s_digitPairs[r];
+    }
+    else
+    {
+        *nstrp++ = (char)((uint32_t)'0' + value);
+    }
+    while ((uint32_t)(nstrp - start) < minDigits)
+    {
+        *nstrp++ = '0';
+    }
+
+    return nstrp;
+}
+
 static int32_t ConvertRadixNumToString(char *numstr, void *nump, unsigned int neg, unsigned int radix, bool use_caps)
 {
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
     long long int a;
-    long long int b;
-    long long int c;
-
     unsigned long long int ua;
     unsigned long long int ub;
-    unsigned long long int uc;
-    unsigned long long int uc_param;
 #else
-    int a;
-    int b;
-    int c;
-
     unsigned int ua;
     unsigned int ub;
-    unsigned int uc;
-    unsigned int uc_param;
 #endif /* PRINTF_ADVANCED_ENABLE */
-
-    int32_t nlen;
+    unsigned int uc;
+    unsigned int shift;
+    const char *digits = use_caps ? "0123456789ABCDEF" : "0123456789abcdef";
     char *nstrp;
 
-    nlen     = 0;
     nstrp    = numstr;
     *nstrp++ = '\0';
 
-#if !(defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0u))
-    neg = 0U;
-#endif
-
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-    a        = 0;
-    b        = 0;
-    c        = 0;
-    ua       = 0ULL;
-    ub       = 0ULL;
-    uc       = 0ULL;
-    uc_param = 0ULL;
-#else
-    a = 0;
-    b = 0;
-    c = 0;
-    ua = 0U;
-    ub = 0U;
-    uc = 0U;
-    uc_param = 0U;
-#endif /* PRINTF_ADVANCED_ENABLE */
-
-    (void)a;
-    (void)b;
-    (void)c;
-    (void)ua;
-    (void)ub;
-    (void)uc;
-    (void)uc_param;
-    (void)neg;
-    /*
-     * Fix MISRA issue: CID 15972928 (#15 of 15): MISRA C-2012 Control Flow Expressions (MISRA C-2012 Rule 14.3)
-     * misra_c_2012_rule_14_3_violation: Execution cannot reach this statement: a = *((int *)nump);
-     */
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
     if (0U != neg)
     {
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
         a = *(long long int *)nump;
+        /* Digits of the magnitude, the sign is added by the caller. Also correct for LLONG_MIN. */
+        ua = (a < 0) ? (0ULL - (unsigned long long int)a) : (unsigned long long int)a;
+    }
+    else
+    {
+        ua = *(unsigned long long int *)nump;
+    }
 #else
-        a = *(int *)nump;
+    (void)neg;
+    ua = *(unsigned int *)nump;
 #endif /* PRINTF_ADVANCED_ENABLE */
-        if (a == 0)
+
+    if (radix == 10U)
+    {
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+        /* Split off 9 digit groups so that at most two 64-bit divisions are needed. */
+        while (ua > 0xFFFFFFFFULL)
         {
-            *nstrp = '0';
-            ++nlen;
-            return nlen;
+            ub    = ua / 1000000000ULL;
+            nstrp = ConvertDecimalToString(nstrp, (uint32_t)(ua - (ub * 1000000000ULL)), 9U);
+            ua    = ub;
         }
-        while (a != 0)
-        {
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-            b = (long long int)a / (long long int)radix;
-            c = (long long int)a - ((long long int)b * (long long int)radix);
-            if (c < 0)
-            {
-                uc       = (unsigned long long int)c;
-                uc_param = ~uc;
-                c        = (long long int)uc_param + 1 + (long long int)'0';
-            }
-#else
-            b = (int)a / (int)radix;
-            c = (int)a - ((int)b * (int)radix);
-            if (c < 0)
-            {
-                uc       = (unsigned int)c;
-                uc_param = ~uc;
-                c        = (int)uc_param + 1 + (int)'0';
-            }
 #endif /* PRINTF_ADVANCED_ENABLE */
-            else
-            {
-                c = c + (int)'0';
-            }
-            a        = b;
-            *nstrp++ = (char)c;
-            ++nlen;
-        }
+        nstrp = ConvertDecimalToString(nstrp, (uint32_t)ua, 1U);
     }
-    else
-#endif /* PRINTF_ADVANCED_ENABLE */
+    else if ((radix & (radix - 1U)) == 0U)
     {
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-        ua = *(unsigned long long int *)nump;
-#else
-        ua = *(unsigned int *)nump;
-#endif /* PRINTF_ADVANCED_ENABLE */
-        if (ua == 0U)
+        for (shift = 0U; (1U << shift) < radix; shift++)
         {
-            *nstrp = '0';
-            ++nlen;
-            return nlen;
         }
-        while (ua != 0U)
+        do
         {
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-            ub = (unsigned long long int)ua / (unsigned long long int)radix;
-            uc = (unsigned long long int)ua - ((unsigned long long int)ub * (unsigned long long int)radix);
-#else
-            ub = ua / (unsigned int)radix;
-            uc = ua - (ub * (unsigned int)radix);
-#endif /* PRINTF_ADVANCED_ENABLE */
-
+            *nstrp++ = digits[(unsigned int)ua & (radix - 1U)];
+            ua >>= shift;
+        } while (ua != 0U);
+    }
+    else
+    {
+        do
+        {
+            ub = ua / radix;
+            uc = (unsigned int)(ua - (ub * radix));
             if (uc < 10U)
             {
                 uc = uc + (unsigned int)'0';
@@ -639,116 +663,153 @@ static int32_t ConvertRadixNumToString(char *numstr, void *nump, unsigned int ne
             {
                 uc = uc - 10U + (unsigned int)(use_caps ? 'A' : 'a');
             }
-            ua       = ub;
             *nstrp++ = (char)uc;
-            ++nlen;
-        }
+            ua       = ub;
+        } while (ua != 0U);
     }
-    return nlen;
+
+    return (int32_t)(nstrp - numstr) - 1;
 }
 
 #if (defined(PRINTF_FLOAT_ENABLE) && (PRINTF_FLOAT_ENABLE > 0U))
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+static bool PrintIsNegativeFloat(const void *nump)
+{
+    uint64_t bits;
+
+    (void)memcpy(&bits, nump, sizeof(bits));
+
+    return ((bits >> 63U) != 0U);
+}
+#endif /* PRINTF_ADVANCED_ENABLE */
+
 static int32_t ConvertFloatRadixNumToString(char *numstr, void *nump, int32_t radix, uint32_t precision_width)
 {
-    int32_t a;
-    int32_t b;
-    int32_t c;
-    int32_t i;
-    uint32_t uc;
-    double fa;
-    double dc;
-    double fb;
-    double r;
-    double fractpart;
-    double intpart;
-
-    int32_t nlen;
+    uint64_t bits;
+    uint64_t mantissa;
+    uint64_t intpart;
+    uint64_t fractpart;
+    uint64_t product;
+    uint32_t q;
+    uint32_t i;
+    int32_t exponent;
+    bool sticky = false;
+    bool roundUp;
     char *nstrp;
-    nlen     = 0;
+
+    assert(radix == 10);
+    (void)radix;
+    precision_width = MIN(precision_width, PRINTF_FLOAT_MAX_PRECISION);
+
     nstrp    = numstr;
     *nstrp++ = '\0';
-    r        = *(double *)nump;
-    if (0.0 == r)
+
+    (void)memcpy(&bits, nump, sizeof(bits));
+    exponent = (int32_t)(uint32_t)((bits >> 52U) & 0x7FFU);
+    mantissa = bits & 0xFFFFFFFFFFFFFULL;
+
+    if (exponent == 0x7FF)
     {
-        *nstrp = '0';
-        ++nlen;
-        return nlen;
+        /* Stored reversed like the digits. */
+        (void)memcpy(nstrp, (mantissa != 0U) ? "nan" : "fni", 3U);
+        return 3;
     }
-    fractpart = modf((double)r, (double *)&intpart);
-    /* Process fractional part. */
-    for (i = 0; i < (int32_t)precision_width; i++)
+
+    /* value = mantissa * 2^exponent */
+    if (exponent != 0)
     {
-        fractpart *= (double)radix;
+        mantissa |= (1ULL << 52U);
     }
-    if (r >= (double)0.0)
+    else
     {
-        fa = fractpart + (double)0.5;
-        if (fa >= pow((double)10, (double)precision_width))
-        {
-            intpart++;
-        }
+        exponent = 1; /* Subnormal. */
     }
-    else
+    exponent -= 1075;
+
+    if (exponent >= 0)
     {
-        fa = fractpart - (double)0.5;
-        if (fa <= -pow((double)10, (double)precision_width))
-        {
-            intpart--;
-        }
+        intpart   = (exponent > 11) ? 0xFFFFFFFFFFFFFFFFULL : (mantissa << (uint32_t)exponent);
+        fractpart = 0U;
+    }
+    else if (exponent > -64)
+    {
+        intpart   = mantissa >> (uint32_t)(-exponent);
+        fractpart = mantissa << (uint32_t)(64 + exponent);
     }
-    for (i = 0; i < (int32_t)precision_width; i++)
+    else
     {
-        fb = fa / (double)radix;
-        dc = (fa - (double)(long long int)fb * (double)radix);
-        c  = (int32_t)dc;
-        if (c < 0)
+        /* Bits shifted out of the 0.64 fraction only matter to break rounding ties. */
+        intpart = 0U;
+        i       = (uint32_t)(-exponent - 64);
+        if (i >= 64U)
         {
-            uc = (uint32_t)c;
-            uc = ~uc;
-            c  = (int32_t)uc;
-            c += (int32_t)1;
-            c += (int32_t)'0';
+            fractpart = 0U;
+            sticky    = (mantissa != 0U);
         }
         else
         {
-            c = c + '0';
+            fractpart = mantissa >> i;
+            sticky    = ((mantissa & ((1ULL << i) - 1U)) != 0U);
         }
-        fa       = fb;
-        *nstrp++ = (char)c;
-        ++nlen;
     }
-    *nstrp++ = (char)'.';
-    ++nlen;
-    a = (int32_t)intpart;
-    if (a == 0)
+
+    /* Fraction digits, most significant first, stored from the end of the fraction field. */
+    for (i = precision_width; i > 0U; i--)
     {
-        *nstrp++ = '0';
-        ++nlen;
+        product   = (uint64_t)(uint32_t)fractpart * 10U;
+        q         = (uint32_t)product;
+        product   = ((fractpart >> 32U) * 10U) + (product >> 32U);
+        fractpart = (product << 32U) | q;
+        nstrp[i - 1U] = (char)((uint32_t)'0' + (uint32_t)(product >> 32U));
+    }
+
+    if (fractpart != 0x8000000000000000ULL)
+    {
+        roundUp = (fractpart > 0x8000000000000000ULL);
+    }
+    else if (sticky)
+    {
+        roundUp = true;
     }
     else
     {
-        while (a != 0)
+        /* Exact tie: round to even. */
+        roundUp = (precision_width != 0U) ? ((((uint32_t)nstrp[0] - (uint32_t)'0') & 1U) != 0U) :
+                                            ((intpart & 1U) != 0U);
+    }
+
+    if (roundUp)
+    {
+        for (i = 0U; i < precision_width; i++)
         {
-            b = (int32_t)a / (int32_t)radix;
-            c = (int32_t)a - ((int32_t)b * (int32_t)radix);
-            if (c < 0)
-            {
-                uc = (uint32_t)c;
-                uc = ~uc;
-                c  = (int32_t)uc;
-                c += (int32_t)1;
-                c += (int32_t)'0';
-            }
-            else
+            if (nstrp[i] != '9')
             {
-                c = c + '0';
+                nstrp[i]++;
+                break;
             }
-            a        = b;
-            *nstrp++ = (char)c;
-            ++nlen;
+            nstrp[i] = '0';
+        }
+        if (i == precision_width)
+        {
+            intpart++;
         }
     }
-    return nlen;
+
+    nstrp += precision_width;
+    if (precision_width != 0U)
+    {
+        *nstrp++ = '.';
+    }
+
+    while (intpart > 0xFFFFFFFFULL)
+    {
+        product = intpart / 1000000000ULL;
+        nstrp   = ConvertDecimalToString(nstrp, (uint32_t)(intpart - (product * 1000000000ULL)), 9U);
+        intpart = product;
+    }
+    nstrp = ConvertDecimalToString(nstrp, (uint32_t)intpart, 1U);
+
+    return (int32_t)(nstrp - numstr) - 1;
 }
 #endif /* PRINTF_FLOAT_ENABLE */
 
@@ -771,7 +832,7 @@ int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb)
     const char *p;
     char c;
 
-    char vstr[33];
+    char vstr[PRINTF_NUMBER_STRING_SIZE];
     char *vstrp  = NULL;
     int32_t vlen = 0;
 
@@ -889,8 +950,7 @@ int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb)
                 vstrp = &vstr[vlen];
 
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-                vlen += (int32_t)PrintGetSignChar(((fval < 0.0) ? ((long long int)-1) : ((long long int)fval)),
-                                                  flags_used, &schar);
+                vlen += (int32_t)PrintGetSignChar(PrintIsNegativeFloat(&fval) ? -1LL : 0LL, flags_used, &schar);
                 PrintOutputdifFobpu(flags_used, field_width, (unsigned int)vlen, schar, vstrp, cb, buf, &count);
 #else
                 PrintOutputdifFobpu(0, field_width, (unsigned int)vlen, '\0', vstrp, cb, buf, &count);